@@ -0,0 +1,103 @@
+#ifdef __cplusplus
+
+#ifndef __DAMAGE_LIST_LIB_H__
+#define __DAMAGE_LIST_LIB_H__
+
+/**
+ * @file DamageList.hpp
+ * @brief Bounded list of modified screen rectangles.
+ */
+
+#include <cstdint>
+#include "FrameBuffer.hpp"
+
+namespace TFT_LCD {
+    /**
+     * @brief Collects modified areas of a frame as a small set of rectangles.
+     *
+     * @details
+     * Rectangles are clipped to the frame. A rectangle that overlaps or
+     * touches a listed one is merged into it. When the list is full the new
+     * rectangle is merged into the entry whose bounding box grows the least,
+     * so the list never loses coverage, it only gets coarser.
+     */
+    class DamageList{
+    public:
+        /** @brief Maximum number of separate rectangles. */
+        static const uint32_t MAX_RECTS {16};
+
+    private:
+        uint32_t _frameWidth;
+        uint32_t _frameHeight;
+        Rect _rects[MAX_RECTS];
+        uint32_t _count = 0;
+
+        /**
+         * @brief Grow a rectangle to the bounding box of itself and another.
+         * @param target Rectangle to grow.
+         * @param other Rectangle to include.
+         */
+        static void unite(Rect& target, const Rect& other);
+
+        /**
+         * @brief Merge entries that overlap `_rects[index]` into it.
+         * @param index Entry that just grew.
+         */
+        void absorbOverlaps(uint32_t index);
+
+    public:
+        /**
+         * @brief Construct an empty list for a frame size.
+         * @param frameWidth Frame width in pixels, used for clipping.
+         * @param frameHeight Frame height in pixels, used for clipping.
+         */
+        DamageList(uint32_t frameWidth, uint32_t frameHeight);
+
+        /**
+         * @brief Add a modified rectangle.
+         * @param rect Modified area; parts outside the frame are ignored.
+         */
+        void add(Rect rect);
+
+        /** @brief Mark the whole frame as modified. */
+        void addAll();
+
+        /** @brief Remove every rectangle. */
+        void clear();
+
+        /**
+         * @brief Check whether nothing was modified.
+         * @return `true` when the list is empty.
+         */
+        bool isEmpty() const {
+            return _count == 0;
+        }
+
+        /**
+         * @brief Get number of listed rectangles.
+         * @return Rectangle count.
+         */
+        uint32_t getCount() const {
+            return _count;
+        }
+
+        /**
+         * @brief Get one listed rectangle.
+         * @param index Rectangle index, less than `getCount()`.
+         * @return Modified area.
+         */
+        const Rect& getRect(uint32_t index) const {
+            return _rects[index];
+        }
+
+        /**
+         * @brief Get the number of pixels covered by the list.
+         * @return Sum of rectangle areas; listed rectangles never overlap.
+         */
+        uint32_t getPixelCount() const;
+    };
+}
+
+#endif // __DAMAGE_LIST_LIB_H__
+
+#endif // __cplusplus
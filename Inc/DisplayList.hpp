@@ -0,0 +1,203 @@
+#ifdef __cplusplus
+
+#ifndef __DISPLAY_LIST_LIB_H__
+#define __DISPLAY_LIST_LIB_H__
+
+/**
+ * @file DisplayList.hpp
+ * @brief Fixed-capacity recorder of drawing calls with replay and optimization.
+ */
+
+#include <cstdint>
+#include <string_view>
+#include "FrameBuffer.hpp"
+#include "font/fonts.hpp"
+#include "font/CompactFont.hpp"
+
+namespace TFT_LCD {
+    /**
+     * @brief Records rectangle and text drawing calls for later replay.
+     *
+     * @details
+     * The recording methods mirror the `FrameBuffer`/`ILI9341` drawing calls,
+     * so screen code written against a template canvas can record into a
+     * list as well as draw directly. Text is copied into an internal pool;
+     * no heap is used. When a command or its text does not fit, it is not
+     * recorded and the list reports overflow.
+     *
+     * `optimize` rewrites the list into an equivalent, cheaper one:
+     * draws completely covered by a later fill are dropped, fills of the same
+     * color that share an edge are merged, and commands are ordered by
+     * destination row where reordering cannot change the result.
+     */
+    class DisplayList{
+    public:
+        /** @brief Maximum number of recorded commands. */
+        static const uint32_t MAX_COMMANDS {64};
+        /** @brief Bytes of text storage shared by all text commands. */
+        static const uint32_t TEXT_POOL_SIZE {512};
+
+        /** @brief Recorded operation. */
+        enum CommandKind : uint8_t{
+            FILL_RECT       = 0,
+            TEXT_SFONT      = 1,
+            TEXT_COMPACT    = 2
+        };
+
+        /**
+         * @brief One recorded drawing call.
+         */
+        struct Command{
+            /** @brief Destination area; for text the cell area of the string. */
+            uint16_t x, y, width, height;
+            /** @brief Font descriptor for text commands. */
+            const void* font;
+            /** @brief Text position in the pool. */
+            uint16_t textOffset;
+            /** @brief Text length in bytes. */
+            uint16_t textLength;
+            /** @brief Fill or glyph color. */
+            Pixel color;
+            /** @brief Operation. */
+            CommandKind kind;
+        };
+
+    private:
+        Command _commands[MAX_COMMANDS];
+        uint32_t _count = 0;
+        char _textPool[TEXT_POOL_SIZE];
+        uint32_t _textUsed = 0;
+        bool _isOverflowed = false;
+
+        /**
+         * @brief Append a command.
+         * @return `false` when the list is full.
+         */
+        bool append(const Command& command);
+
+        /**
+         * @brief Copy text into the pool.
+         * @param text Text to store.
+         * @param offset Receives the pool offset.
+         * @return `false` when the pool is full.
+         */
+        bool storeText(std::string_view text, uint16_t& offset);
+
+        /** @brief Remove commands marked with zero width, keeping order. */
+        void compact();
+
+        /**
+         * @brief Drop commands completely covered by a later fill.
+         * @return Number of commands removed.
+         */
+        uint32_t removeOccluded();
+
+        /**
+         * @brief Merge same-colour fills that share an edge.
+         * @return Number of fills merged away.
+         */
+        uint32_t mergeFills();
+
+        /** @brief Order commands by row where they do not overlap. */
+        void sortByRow();
+
+    public:
+        DisplayList() = default;
+
+        /**
+         * @brief Record a filled rectangle.
+         * @return `false` when the list is full.
+         */
+        bool drawRectangle(uint32_t x, uint32_t y, uint32_t width, uint32_t height, Pixel color);
+
+        /**
+         * @brief Record a text string drawn with an `sFONT` font.
+         * @return `false` when the list or text pool is full.
+         */
+        bool putText(std::string_view text, uint32_t x, uint32_t y, const sFONT& font, Pixel color);
+
+        /**
+         * @brief Record a text string drawn with a compact font.
+         * @return `false` when the list or text pool is full.
+         */
+        bool putText(std::string_view text, uint32_t x, uint32_t y, const CompactFont& font, Pixel color);
+
+        /**
+         * @brief Rewrite the list into an equivalent list with fewer pixel writes.
+         * @return Number of commands removed.
+         */
+        uint32_t optimize();
+
+        /**
+         * @brief Draw every command onto a target.
+         * @details `Target` is any type with the `FrameBuffer` drawing calls,
+         *          e.g. `FrameBuffer` or `ILI9341`.
+         * @param target Canvas to draw on.
+         */
+        template<typename Target>
+        void replay(Target& target) const {
+            for(uint32_t idx = 0; idx < _count; idx++){
+                const Command& command = _commands[idx];
+
+                switch(command.kind){
+                case FILL_RECT:
+                    target.drawRectangle(command.x, command.y, command.width, command.height, command.color);
+                    break;
+                case TEXT_SFONT:
+                    target.putText(getText(command), command.x, command.y, *static_cast<const sFONT*>(command.font), command.color);
+                    break;
+                case TEXT_COMPACT:
+                    target.putText(getText(command), command.x, command.y, *static_cast<const CompactFont*>(command.font), command.color);
+                    break;
+                }
+            }
+        }
+
+        /** @brief Remove every command and all stored text. */
+        void clear();
+
+        /**
+         * @brief Get number of recorded commands.
+         * @return Command count.
+         */
+        uint32_t getCount() const {
+            return _count;
+        }
+
+        /**
+         * @brief Get one recorded command.
+         * @param index Command index, less than `getCount()`.
+         * @return Command descriptor.
+         */
+        const Command& getCommand(uint32_t index) const {
+            return _commands[index];
+        }
+
+        /**
+         * @brief Get the text of a text command.
+         * @param command Command recorded by this list.
+         * @return Stored text.
+         */
+        std::string_view getText(const Command& command) const {
+            return std::string_view(&_textPool[command.textOffset], command.textLength);
+        }
+
+        /**
+         * @brief Check whether a command was rejected for lack of space.
+         * @return `true` after an overflow, until `clear`.
+         */
+        bool isOverflowed() const {
+            return _isOverflowed;
+        }
+
+        /**
+         * @brief Get number of pixels written by the fill commands.
+         * @return Sum of fill areas.
+         */
+        uint32_t getFillPixelCount() const;
+    };
+}
+
+#endif // __DISPLAY_LIST_LIB_H__
+
+#endif // __cplusplus
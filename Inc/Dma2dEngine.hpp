@@ -0,0 +1,195 @@
+#ifdef __cplusplus
+
+#ifndef __DMA2D_ENGINE_LIB_H__
+#define __DMA2D_ENGINE_LIB_H__
+
+/**
+ * @file Dma2dEngine.hpp
+ * @brief DMA2D transfers on RGB565 frame-buffer regions.
+ *
+ * @details
+ * Every operation programs the DMA2D mode, layer formats and line offsets
+ * itself, so the handle does not have to keep a particular CubeMX
+ * configuration between calls.
+ */
+
+#include <cstdint>
+#include "FrameBuffer.hpp"
+#include "main.h"
+
+namespace TFT_LCD {
+    /**
+     * @brief DMA2D operations on RGB565 pixel rectangles.
+     *
+     * @details
+     * Operations block until the transfer completes; they first wait for a
+     * transfer started by another user of the handle, calling the wait
+     * handler meanwhile so a task can sleep instead of spinning while queued
+     * jobs drain. The transfer itself is polled. The `start` variants return
+     * once the transfer is running and report completion through the
+     * handle's `XferCpltCallback`.
+     */
+    class Dma2dEngine{
+    public:
+        /** @brief Alpha-only source formats accepted by `blend`. */
+        enum AlphaFormat : uint8_t{
+            A4 = 4,
+            A8 = 8
+        };
+
+        /** @brief Called repeatedly while a DMA2D wait is not satisfied. */
+        typedef void (*WaitHandler)(void* context);
+
+    private:
+        /** @brief Wait handler shared by all users; the MCU has one DMA2D. */
+        static WaitHandler _waitHandler;
+        /** @brief Argument passed to `_waitHandler`. */
+        static void* _waitContext;
+
+        /** @brief DMA2D peripheral handle. */
+        DMA2D_HandleTypeDef* const _hdma2d;
+
+        /**
+         * @brief Program a memory-to-memory transfer to RGB565 without starting it.
+         * @param mode `DMA2D_M2M` for a copy or `DMA2D_M2M_PFC` for a conversion.
+         * @param inputColorMode DMA2D source color mode.
+         * @param sourcePitch Source line length in pixels.
+         * @param destinationPitch Destination line length in pixels.
+         * @param width Rectangle width in pixels.
+         */
+        void setupTransfer(uint32_t mode, uint32_t inputColorMode, uint32_t sourcePitch, uint32_t destinationPitch, uint32_t width);
+
+        /**
+         * @brief Program a constant-alpha RGB565 blend without starting it.
+         * @param foregroundPitch Foreground line length in pixels.
+         * @param backgroundPitch Background line length in pixels.
+         * @param alpha Foreground opacity, 0 to 255.
+         * @param destinationPitch Destination line length in pixels.
+         * @param width Rectangle width in pixels.
+         */
+        void setupBlend(uint32_t foregroundPitch, uint32_t backgroundPitch, uint8_t alpha, uint32_t destinationPitch, uint32_t width);
+
+        /**
+         * @brief Program an RGB565 register-to-memory fill without starting it.
+         * @param destinationPitch Destination line length in pixels.
+         * @param width Rectangle width in pixels.
+         */
+        void setupFill(uint32_t destinationPitch, uint32_t width);
+
+        /** @brief Wait for a transfer started with a `start` variant to finish. */
+        void waitUntilIdle();
+
+    public:
+        /**
+         * @brief Construct engine on a DMA2D handle.
+         * @param hdma2d DMA2D handle; must not be null.
+         */
+        explicit Dma2dEngine(DMA2D_HandleTypeDef* hdma2d);
+
+        /**
+         * @brief Set the function called while DMA2D waits are not satisfied.
+         * @details Used by the blocking operations and by `Dma2dQueue`, e.g.
+         *          to sleep until the next DMA2D interrupt under an RTOS.
+         * @param handler Wait handler, or null to spin.
+         * @param context Argument passed to the handler.
+         */
+        static void setWaitHandler(WaitHandler handler, void* context);
+
+        /** @brief Let the wait handler run once; does nothing without one. */
+        static void idle();
+
+        /**
+         * @brief Copy an RGB565 rectangle.
+         * @param source First source pixel.
+         * @param sourcePitch Source line length in pixels.
+         * @param destination First destination pixel.
+         * @param destinationPitch Destination line length in pixels.
+         * @param width Rectangle width in pixels.
+         * @param height Rectangle height in pixels.
+         */
+        void copy(const Pixel* source, uint32_t sourcePitch, Pixel* destination, uint32_t destinationPitch, uint32_t width, uint32_t height);
+
+        /**
+         * @brief Start an RGB565 rectangle copy with the transfer-complete interrupt.
+         * @details Returns immediately. The DMA2D IRQ handler must call
+         *          `HAL_DMA2D_IRQHandler`, which invokes `XferCpltCallback`.
+         * @param source First source pixel.
+         * @param sourcePitch Source line length in pixels.
+         * @param destination First destination pixel.
+         * @param destinationPitch Destination line length in pixels.
+         * @param width Rectangle width in pixels.
+         * @param height Rectangle height in pixels.
+         * @return `false` when the HAL refused to start; no interrupt follows.
+         */
+        bool startCopy(const Pixel* source, uint32_t sourcePitch, Pixel* destination, uint32_t destinationPitch, uint32_t width, uint32_t height);
+
+        /**
+         * @brief Blend a constant color through an alpha mask onto RGB565 pixels.
+         * @details For `A4` the first pixel of each byte is in bits [3:0].
+         * @param alpha First byte of the alpha mask; rows are packed without padding.
+         * @param format Alpha mask format.
+         * @param color Foreground color.
+         * @param destination First destination pixel, also the blend background.
+         * @param destinationPitch Destination line length in pixels.
+         * @param width Rectangle width in pixels; must be even for `A4`.
+         * @param height Rectangle height in pixels.
+         */
+        void blend(const uint8_t* alpha, AlphaFormat format, Pixel color, Pixel* destination, uint32_t destinationPitch, uint32_t width, uint32_t height);
+
+        /**
+         * @brief Blend two RGB565 rectangles with a constant alpha.
+         * @param foreground First foreground pixel.
+         * @param foregroundPitch Foreground line length in pixels.
+         * @param background First background pixel.
+         * @param backgroundPitch Background line length in pixels.
+         * @param alpha Foreground opacity, 0 to 255.
+         * @param destination First destination pixel; may be the background.
+         * @param destinationPitch Destination line length in pixels.
+         * @param width Rectangle width in pixels.
+         * @param height Rectangle height in pixels.
+         */
+        void blend(const Pixel* foreground, uint32_t foregroundPitch, const Pixel* background, uint32_t backgroundPitch, uint8_t alpha, Pixel* destination, uint32_t destinationPitch, uint32_t width, uint32_t height);
+
+        /**
+         * @brief Start a constant-alpha blend with the transfer-complete interrupt.
+         * @details Parameters as for the blocking constant-alpha `blend`.
+         * @return `false` when the HAL refused to start; no interrupt follows.
+         */
+        bool startBlend(const Pixel* foreground, uint32_t foregroundPitch, const Pixel* background, uint32_t backgroundPitch, uint8_t alpha, Pixel* destination, uint32_t destinationPitch, uint32_t width, uint32_t height);
+
+        /**
+         * @brief Fill an RGB565 rectangle with one color.
+         * @param color Fill color.
+         * @param destination First destination pixel.
+         * @param destinationPitch Destination line length in pixels.
+         * @param width Rectangle width in pixels.
+         * @param height Rectangle height in pixels.
+         */
+        void fill(Pixel color, Pixel* destination, uint32_t destinationPitch, uint32_t width, uint32_t height);
+
+        /**
+         * @brief Start a fill with the transfer-complete interrupt.
+         * @details Parameters as for `fill`.
+         * @return `false` when the HAL refused to start; no interrupt follows.
+         */
+        bool startFill(Pixel color, Pixel* destination, uint32_t destinationPitch, uint32_t width, uint32_t height);
+
+        /**
+         * @brief Start a pixel-format conversion to RGB565 with the transfer-complete interrupt.
+         * @details Indexed formats need their CLUT loaded beforehand.
+         * @param source First source pixel.
+         * @param sourcePitch Source line length in pixels.
+         * @param inputColorMode DMA2D source color mode, e.g. `DMA2D_INPUT_ARGB8888`.
+         * @param destination First destination pixel.
+         * @param destinationPitch Destination line length in pixels.
+         * @param width Rectangle width in pixels.
+         * @param height Rectangle height in pixels.
+         * @return `false` when the HAL refused to start; no interrupt follows.
+         */
+        bool startConvert(const void* source, uint32_t sourcePitch, uint32_t inputColorMode, Pixel* destination, uint32_t destinationPitch, uint32_t width, uint32_t height);
+    };
+}
+
+#endif // __DMA2D_ENGINE_LIB_H__
+
+#endif // __cplusplus
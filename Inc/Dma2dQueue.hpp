@@ -0,0 +1,225 @@
+#ifdef __cplusplus
+
+#ifndef __DMA2D_QUEUE_LIB_H__
+#define __DMA2D_QUEUE_LIB_H__
+
+/**
+ * @file Dma2dQueue.hpp
+ * @brief Asynchronous DMA2D job queue with completion fences.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include "FrameBuffer.hpp"
+#include "main.h"
+
+namespace TFT_LCD {
+    /**
+     * @brief Runs fill, copy, conversion and blend jobs back to back on DMA2D.
+     *
+     * @details
+     * Submitting a job returns at once with a fence. Jobs run in submission
+     * order; each transfer-complete interrupt starts the next job, so the
+     * CPU only programs the first one. `waitForArea` blocks only until the
+     * newest job that reads or writes a given rectangle has finished, so CPU
+     * drawing elsewhere proceeds in parallel.
+     *
+     * Jobs are submitted from one task; `onTransferComplete` must be called
+     * from the handle's `XferCpltCallback` and `onTransferError` from its
+     * `XferErrorCallback`. A failed job still completes its fence, so waits
+     * always end; failures are counted. Waits call the `Dma2dEngine` wait
+     * handler between checks; without one they spin.
+     */
+    class Dma2dQueue{
+    public:
+        /** @brief Maximum number of jobs in flight; a power of two. */
+        static const uint32_t MAX_JOBS {16};
+
+        /** @brief Completion marker of a job; 0 is always complete. */
+        typedef uint32_t Fence;
+
+        /** @brief Job operation. */
+        enum JobKind : uint8_t{
+            FILL        = 0,
+            COPY        = 1,
+            CONVERT     = 2,
+            BLEND       = 3
+        };
+
+    private:
+        static_assert((MAX_JOBS & (MAX_JOBS - 1)) == 0, "MAX_JOBS must be a power of two");
+
+        /** @brief Queued DMA2D operation. */
+        struct Job{
+            /** @brief Source pixels; unused by `FILL`. */
+            const void* source;
+            /** @brief First destination pixel; also the `BLEND` background. */
+            Pixel* destination;
+            /** @brief Fill color, or the source color mode for `CONVERT`. */
+            uint32_t argument;
+            uint16_t sourcePitch;
+            uint16_t destinationPitch;
+            uint16_t width;
+            uint16_t height;
+            uint8_t alpha;
+            JobKind kind;
+
+            /** @brief Frame buffer written, for overlap tests. */
+            const void* targetBuffer;
+            Rect targetArea;
+            /** @brief Frame buffer read, for overlap tests; null for external sources. */
+            const void* sourceBuffer;
+            Rect sourceArea;
+        };
+
+        DMA2D_HandleTypeDef* const _hdma2d;
+        Job _jobs[MAX_JOBS];
+
+        /** @brief Fence of the newest submitted job. */
+        std::atomic<uint32_t> _submitted {0};
+        /** @brief Fence of the newest finished job. */
+        std::atomic<uint32_t> _completed {0};
+        /** @brief Set while DMA2D works through the queue. */
+        std::atomic<bool> _isRunning {false};
+
+        /** @brief CPU waits caused by overlapping jobs. */
+        uint32_t _waitCount = 0;
+        /** @brief Jobs that failed to start or ended with a DMA2D error. */
+        volatile uint32_t _errorCount = 0;
+
+
+        /**
+         * @brief Add a job and start DMA2D if it is idle.
+         * @param job Job to run.
+         * @return Fence of the job.
+         */
+        Fence push(const Job& job);
+
+        /**
+         * @brief Program and start one job.
+         * @param fence Fence of the job to start.
+         * @return `false` when DMA2D did not start; no interrupt follows.
+         */
+        bool start(Fence fence);
+
+        /** @brief Complete the running job and start the next one that starts. */
+        void finishJob();
+
+    public:
+        /**
+         * @brief Construct queue on a DMA2D handle.
+         * @param hdma2d DMA2D handle; must not be null.
+         */
+        explicit Dma2dQueue(DMA2D_HandleTypeDef* hdma2d);
+
+        /**
+         * @brief Queue a solid fill.
+         * @param target Destination frame buffer.
+         * @param area Rectangle to fill.
+         * @param color Fill color.
+         * @return Fence of the job.
+         */
+        Fence fill(FrameBuffer& target, const Rect& area, Pixel color);
+
+        /**
+         * @brief Queue an RGB565 copy.
+         * @param source Source frame buffer.
+         * @param area Source rectangle.
+         * @param target Destination frame buffer.
+         * @param x Destination left pixel coordinate.
+         * @param y Destination top pixel coordinate.
+         * @return Fence of the job.
+         */
+        Fence copy(const FrameBuffer& source, const Rect& area, FrameBuffer& target, uint32_t x, uint32_t y);
+
+        /**
+         * @brief Queue a pixel-format conversion into RGB565.
+         * @param source First source pixel; must stay valid until the fence completes.
+         * @param sourcePitch Source line length in pixels.
+         * @param inputColorMode DMA2D source color mode, e.g. `DMA2D_INPUT_ARGB8888`.
+         * @param target Destination frame buffer.
+         * @param area Destination rectangle.
+         * @return Fence of the job.
+         */
+        Fence convert(const void* source, uint32_t sourcePitch, uint32_t inputColorMode, FrameBuffer& target, const Rect& area);
+
+        /**
+         * @brief Queue a constant-alpha blend over the destination.
+         * @param source Foreground frame buffer.
+         * @param area Foreground rectangle.
+         * @param alpha Foreground opacity, 0 to 255.
+         * @param target Destination frame buffer, also the background.
+         * @param x Destination left pixel coordinate.
+         * @param y Destination top pixel coordinate.
+         * @return Fence of the job.
+         */
+        Fence blend(const FrameBuffer& source, const Rect& area, uint8_t alpha, FrameBuffer& target, uint32_t x, uint32_t y);
+
+        /**
+         * @brief Check whether a job has finished.
+         * @param fence Fence returned at submission.
+         * @return `true` once the job and every job before it are done.
+         */
+        bool isComplete(Fence fence) const {
+            return static_cast<int32_t>(_completed.load() - fence) >= 0;
+        }
+
+        /**
+         * @brief Block until a job has finished.
+         * @param fence Fence returned at submission.
+         */
+        void wait(Fence fence);
+
+        /**
+         * @brief Block until no queued job reads or writes a rectangle.
+         * @param buffer Frame buffer the CPU is about to draw into.
+         * @param area Rectangle the CPU is about to draw.
+         */
+        void waitForArea(const FrameBuffer& buffer, const Rect& area);
+
+        /** @brief Block until every queued job has finished. */
+        void waitIdle();
+
+        /**
+         * @brief Check whether jobs are queued or running.
+         * @return `true` until the last job has finished.
+         */
+        bool isBusy() const {
+            return _isRunning.load();
+        }
+
+        /**
+         * @brief Get number of CPU waits caused by overlapping jobs.
+         * @return Counter of `waitForArea` calls that had to wait.
+         */
+        uint32_t getWaitCount() const {
+            return _waitCount;
+        }
+
+        /**
+         * @brief Get number of failed jobs.
+         * @return Jobs that could not be started or ended with a DMA2D error.
+         */
+        uint32_t getErrorCount() const {
+            return _errorCount;
+        }
+
+        /**
+         * @brief Finish the running job and start the next one.
+         * @details Call from the `XferCpltCallback` of the DMA2D handle.
+         */
+        void onTransferComplete();
+
+        /**
+         * @brief Fail the running job and start the next one.
+         * @details Call from the `XferErrorCallback` of the DMA2D handle
+         *          (transfer, CLUT access and configuration errors). The
+         *          destination of the failed job is left undefined.
+         */
+        void onTransferError();
+    };
+}
+
+#endif // __DMA2D_QUEUE_LIB_H__
+
+#endif // __cplusplus
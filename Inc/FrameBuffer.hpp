@@ -10,8 +10,11 @@
  */
 
 #include <cstdint>
-#include <string>
+#include <string_view>
 #include "font/fonts.hpp"
+#include "font/ProportionalFont.hpp"
+#include "font/AntiAliasedFont.hpp"
+#include "font/CompactFont.hpp"
 #include "main.h"
 
 namespace TFT_LCD {
@@ -43,6 +46,34 @@ namespace TFT_LCD {
         }
     };
 
+    /**
+     * @brief Axis-aligned pixel rectangle.
+     */
+    struct Rect{
+        /** @brief Left pixel coordinate. */
+        uint32_t x;
+        /** @brief Top pixel coordinate. */
+        uint32_t y;
+        /** @brief Width in pixels. */
+        uint32_t width;
+        /** @brief Height in pixels. */
+        uint32_t height;
+    };
+
+    /**
+     * @brief Field layout for `FrameBuffer::putNumber`.
+     */
+    struct NumberFormat{
+        /** @brief Minimum field width in characters, including sign and point. */
+        uint8_t width = 0;
+        /** @brief Fixed-point digits after the decimal point. */
+        uint8_t decimals = 0;
+        /** @brief Pad character, `' '` (before the sign) or `'0'` (after it). */
+        char padding = ' ';
+        /** @brief Print `'+'` for positive values. */
+        bool showPlus = false;
+    };
+
     /**
      * @brief 2D RGB565 frame-buffer utility.
      */
@@ -53,6 +84,13 @@ namespace TFT_LCD {
             RGB565  = 2
         };
 
+        /**
+         * @brief Smallest glyph area, in pixels, blended with DMA2D instead of the CPU.
+         * @details Not tuned on hardware: the DMA2D glyph rate has not been
+         *          measured, so the break-even size against the CPU blend is an estimate.
+         */
+        static const uint32_t DMA2D_BLEND_MIN_PIXELS {64};
+
     private:
         Pixel* _buffer = nullptr;
         uint32_t _width = 0;
@@ -128,6 +166,21 @@ namespace TFT_LCD {
          * @param hdma2d Optional DMA2D handle. If null, `memcpy` is used.
          */
         void copyBuffer(FrameBuffer& other,DMA2D_HandleTypeDef * hdma2d = nullptr);
+        /**
+         * @brief Copy one rectangle from another buffer of the same size.
+         * @param other Source frame buffer.
+         * @param area Rectangle to copy, in pixels.
+         * @param hdma2d Optional DMA2D handle. If null, rows are copied with `memcpy`.
+         */
+        void copyRect(const FrameBuffer& other,const Rect& area,DMA2D_HandleTypeDef * hdma2d = nullptr);
+        /**
+         * @brief Draw a buffer of half the size scaled up 2x, filling this buffer.
+         * @details Each source pixel becomes one 32-bit word of two pixels;
+         *          each finished row is then copied once to make the row below.
+         *          Nothing is drawn when the scaled source does not fit.
+         * @param source Frame buffer of at most half the width and height.
+         */
+        void upscale2x(const FrameBuffer& source);
 
         /**
          * @brief Draw a filled rectangle.
@@ -141,15 +194,18 @@ namespace TFT_LCD {
 
         /**
          * @brief Draw a text string.
+         * @details Text is decoded as UTF-8; each code point takes one cell and
+         *          code points outside printable ASCII are left blank.
          * @param text Text to render.
          * @param x Left pixel coordinate.
          * @param y Top pixel coordinate.
          * @param font Font descriptor.
          * @param color Glyph color.
          */
-        void putText(std::string text, uint32_t x,uint32_t y,const sFONT& font,Pixel color);
+        void putText(std::string_view text, uint32_t x,uint32_t y,const sFONT& font,Pixel color);
         /**
          * @brief Draw a single character.
+         * @details Characters outside printable ASCII (0x20..0x7E) are ignored.
          * @param character ASCII character code.
          * @param x Left pixel coordinate.
          * @param y Top pixel coordinate.
@@ -157,6 +213,191 @@ namespace TFT_LCD {
          * @param color Glyph color.
          */
         void putChar(uint8_t character,uint32_t x,uint32_t y,const sFONT& font,Pixel color);
+        /**
+         * @brief Draw a single character cell in opaque mode.
+         * @details Characters outside printable ASCII are drawn as a blank cell.
+         * @param character ASCII character code.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         * @param font Font descriptor.
+         * @param color Glyph color.
+         * @param background Cell background color.
+         */
+        void putChar(uint8_t character,uint32_t x,uint32_t y,const sFONT& font,Pixel color,Pixel background);
+
+        /**
+         * @brief Draw an integer or fixed-point number without string formatting.
+         * @details `value` is scaled by `10^format.decimals`, so `-1234` with two
+         *          decimals draws `-12.34`. Digits go straight to `putChar`.
+         * @param value Number to draw.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         * @param font Font descriptor.
+         * @param color Glyph color.
+         * @param format Field width, decimals, padding and sign.
+         * @return Width of the drawn field in pixels.
+         */
+        uint32_t putNumber(int32_t value, uint32_t x,uint32_t y,const sFONT& font,Pixel color,NumberFormat format = {});
+        /**
+         * @brief Draw an integer or fixed-point number with a compact font.
+         * @param value Number to draw, scaled by `10^format.decimals`.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         * @param font Compact font descriptor.
+         * @param color Glyph color.
+         * @param format Field width, decimals, padding and sign.
+         * @return Width of the drawn field in pixels.
+         */
+        uint32_t putNumber(int32_t value, uint32_t x,uint32_t y,const CompactFont& font,Pixel color,NumberFormat format = {});
+
+        /**
+         * @brief Get the length of a `putNumber` field.
+         * @param value Number, scaled by `10^format.decimals`.
+         * @param format Field width, decimals, padding and sign.
+         * @return Field length in characters.
+         */
+        static uint32_t getNumberLength(int32_t value, NumberFormat format = {});
+
+        /**
+         * @brief Measure the width of a text string.
+         * @param text UTF-8 text to measure.
+         * @param font Font descriptor.
+         * @return Width in pixels, one cell per code point.
+         */
+        static uint32_t measureText(std::string_view text,const sFONT& font);
+
+        /**
+         * @brief Draw a text string magnified by an integer factor.
+         * @details Each glyph pixel becomes a `scale` x `scale` block; no extra
+         *          font tables are needed.
+         * @param text Text to render.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         * @param font Font descriptor.
+         * @param color Glyph color.
+         * @param scale Integer magnification, 1 or more.
+         */
+        void putTextScaled(std::string_view text, uint32_t x,uint32_t y,const sFONT& font,Pixel color,uint32_t scale);
+        /**
+         * @brief Draw a single character magnified by an integer factor.
+         * @param character ASCII character code.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         * @param font Font descriptor.
+         * @param color Glyph color.
+         * @param scale Integer magnification, 1 or more.
+         */
+        void putCharScaled(uint8_t character,uint32_t x,uint32_t y,const sFONT& font,Pixel color,uint32_t scale);
+
+        /**
+         * @brief Draw a text string with a proportional font.
+         * @details Text is decoded as UTF-8. The pen advances by each glyph's
+         *          advance plus pair kerning; code points without a glyph are skipped.
+         * @param text Text to render.
+         * @param x Left pixel coordinate of the pen.
+         * @param y Top pixel coordinate.
+         * @param font Proportional font descriptor.
+         * @param color Glyph color.
+         */
+        void putText(std::string_view text, uint32_t x,uint32_t y,const ProportionalFont& font,Pixel color);
+        /**
+         * @brief Draw a single character with a proportional font.
+         * @param codepoint Unicode code point.
+         * @param x Left pixel coordinate of the pen.
+         * @param y Top pixel coordinate.
+         * @param font Proportional font descriptor.
+         * @param color Glyph color.
+         */
+        void putChar(uint32_t codepoint,uint32_t x,uint32_t y,const ProportionalFont& font,Pixel color);
+
+        /**
+         * @brief Measure the pen advance of a text string.
+         * @param text Text to measure.
+         * @param font Proportional font descriptor.
+         * @return Total advance in pixels, including kerning.
+         */
+        static uint32_t measureText(std::string_view text,const ProportionalFont& font);
+
+        /**
+         * @brief Draw a text string with an anti-aliased font.
+         * @details Glyphs of at least `DMA2D_BLEND_MIN_PIXELS` pixels are blended
+         *          by DMA2D when a handle is given, smaller ones on the CPU.
+         * @param text Text to render.
+         * @param x Left pixel coordinate of the pen.
+         * @param y Top pixel coordinate.
+         * @param font Anti-aliased font descriptor.
+         * @param color Glyph color.
+         * @param hdma2d Optional DMA2D handle. If null, glyphs are blended on the CPU.
+         */
+        void putText(std::string_view text, uint32_t x,uint32_t y,const AntiAliasedFont& font,Pixel color,DMA2D_HandleTypeDef * hdma2d = nullptr);
+        /**
+         * @brief Draw a single character with an anti-aliased font.
+         * @param codepoint Unicode code point.
+         * @param x Left pixel coordinate of the pen.
+         * @param y Top pixel coordinate.
+         * @param font Anti-aliased font descriptor.
+         * @param color Glyph color.
+         * @param hdma2d Optional DMA2D handle. If null, the glyph is blended on the CPU.
+         */
+        void putChar(uint32_t codepoint,uint32_t x,uint32_t y,const AntiAliasedFont& font,Pixel color,DMA2D_HandleTypeDef * hdma2d = nullptr);
+
+        /**
+         * @brief Measure the pen advance of a text string.
+         * @param text Text to measure.
+         * @param font Anti-aliased font descriptor.
+         * @return Total advance in pixels, including kerning.
+         */
+        static uint32_t measureText(std::string_view text,const AntiAliasedFont& font);
+
+        /**
+         * @brief Draw a text string with a compact font.
+         * @details Text is decoded as UTF-8; each code point takes one cell.
+         * @param text Text to render.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         * @param font Compact font descriptor.
+         * @param color Glyph color.
+         */
+        void putText(std::string_view text, uint32_t x,uint32_t y,const CompactFont& font,Pixel color);
+        /**
+         * @brief Draw a single character with a compact font.
+         * @param codepoint Unicode code point.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         * @param font Compact font descriptor.
+         * @param color Glyph color.
+         */
+        void putChar(uint32_t codepoint,uint32_t x,uint32_t y,const CompactFont& font,Pixel color);
+
+        /**
+         * @brief Measure the width of a text string.
+         * @param text UTF-8 text to measure.
+         * @param font Compact font descriptor.
+         * @return Width in pixels, one cell per code point.
+         */
+        static uint32_t measureText(std::string_view text,const CompactFont& font);
+
+    private:
+        /**
+         * @brief Draw one proportional glyph bitmap.
+         * @param font Font that owns the glyph.
+         * @param glyph Glyph metrics.
+         * @param penX Pen X coordinate; the bitmap starts at `penX + bearingX`.
+         * @param y Top pixel coordinate.
+         * @param color Glyph color.
+         */
+        void drawGlyph(const ProportionalFont& font,const GlyphMetrics& glyph,int32_t penX,uint32_t y,Pixel color);
+
+        /**
+         * @brief Blend one anti-aliased glyph.
+         * @param font Font that owns the glyph.
+         * @param glyph Glyph metrics.
+         * @param penX Pen X coordinate; the bitmap starts at `penX + bearingX`.
+         * @param y Top pixel coordinate.
+         * @param color Glyph color.
+         * @param hdma2d Optional DMA2D handle.
+         */
+        void blendGlyph(const AntiAliasedFont& font,const GlyphMetrics& glyph,int32_t penX,uint32_t y,Pixel color,DMA2D_HandleTypeDef * hdma2d);
     };
 }
 
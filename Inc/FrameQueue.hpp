@@ -0,0 +1,181 @@
+#ifdef __cplusplus
+
+#ifndef __FRAME_QUEUE_LIB_H__
+#define __FRAME_QUEUE_LIB_H__
+
+/**
+ * @file FrameQueue.hpp
+ * @brief Lock-free exchange of N frame buffers between a render task and vblank.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include "DamageList.hpp"
+#include "FrameBuffer.hpp"
+#include "main.h"
+
+namespace TFT_LCD {
+    /**
+     * @brief Render, queued and displayed buffer bookkeeping for N-buffering.
+     *
+     * @details
+     * One buffer is displayed, at most one is queued for the next vertical
+     * blanking and the render task draws into a third. `submit` queues the
+     * render buffer, replacing (dropping) a queued frame that was not shown
+     * yet. The vblank handler takes the queued buffer with `takeQueued`.
+     * The two sides share only two atomic indices; the task reads the queued
+     * index before the displayed one, so a vblank in between can only make a
+     * busy buffer look busy twice, never make it look free.
+     *
+     * Drawing is incremental, so a buffer that becomes the render target
+     * first receives the areas drawn into newer frames since it was last
+     * rendered (`refreshRenderBuffer`).
+     */
+    class FrameQueue{
+    public:
+        /** @brief Maximum number of buffers in the queue. */
+        static const uint32_t MAX_BUFFERS {3};
+        /** @brief Index value meaning "no buffer". */
+        static const uint32_t NO_BUFFER {0xFF};
+
+        /**
+         * @brief Frame pacing counters.
+         */
+        struct Statistics{
+            /** @brief Frames submitted by the render task. */
+            uint32_t submittedFrames;
+            /** @brief Frames latched by the vblank handler. */
+            uint32_t displayedFrames;
+            /** @brief Queued frames replaced before they were shown. */
+            uint32_t droppedFrames;
+            /** @brief Time between the last two submissions in milliseconds. */
+            uint32_t lastFrameTime;
+            /** @brief Longest time between two submissions in milliseconds. */
+            uint32_t maxFrameTime;
+            /** @brief Total time the render task waited for a free buffer in milliseconds. */
+            uint32_t stallTime;
+        };
+
+    private:
+        FrameBuffer* _buffers = nullptr;
+        uint32_t _count = 0;
+
+        std::atomic<uint32_t> _queued {NO_BUFFER};
+        std::atomic<uint32_t> _displayed {0};
+        uint32_t _render = NO_BUFFER;
+        uint32_t _lastSubmitted = NO_BUFFER;
+
+        /** @brief Areas each buffer is missing relative to the newest frame. */
+        DamageList _staleAreas[MAX_BUFFERS] {
+            {0, 0}, {0, 0}, {0, 0}
+        };
+
+        Statistics _statistics {};
+        uint32_t _lastSubmitTick = 0;
+
+    public:
+        FrameQueue() = default;
+
+        /**
+         * @brief Start queueing over a set of frame buffers.
+         * @details Buffer 0 is assumed to be displayed and holds the current
+         *          frame; buffer 1 becomes the first render target.
+         * @param buffers Frame buffer array of equal geometry.
+         * @param count Number of buffers, 2 to `MAX_BUFFERS`.
+         */
+        void attach(FrameBuffer* buffers, uint32_t count);
+
+        /**
+         * @brief Check whether the queue has been attached to buffers.
+         * @return `true` after `attach`.
+         */
+        bool isAttached() const {
+            return _count != 0;
+        }
+
+        /**
+         * @brief Get the frame buffer the render task draws into.
+         * @return Current render target.
+         */
+        FrameBuffer& getRenderBuffer(){
+            return _buffers[_render];
+        }
+
+        /**
+         * @brief Get the frame buffer currently scanned out.
+         * @return Displayed buffer.
+         */
+        const FrameBuffer& getDisplayedBuffer() const {
+            return _buffers[_displayed.load()];
+        }
+
+        /**
+         * @brief Queue the render buffer for the next vertical blanking.
+         * @param damage Areas drawn into the render buffer since it was acquired.
+         * @param now Current time in milliseconds, for frame time statistics.
+         * @return `true` when a queued frame that was never shown was dropped.
+         */
+        bool submit(const DamageList& damage, uint32_t now);
+
+        /**
+         * @brief Pick a buffer that is neither displayed nor queued as render target.
+         * @return `false` when every other buffer is busy; retry after a vblank.
+         */
+        bool tryAcquire();
+
+        /**
+         * @brief Take the queued buffer back as render target, dropping its frame.
+         * @details Recovery when no vblank arrives; the buffer already holds
+         *          the newest frame, so nothing has to be refreshed.
+         * @return `false` when nothing is queued any more.
+         */
+        bool reclaimQueued();
+
+        /**
+         * @brief Copy the areas the render buffer is missing from the newest frame.
+         * @param hdma2d Optional DMA2D handle used for the copies.
+         */
+        void refreshRenderBuffer(DMA2D_HandleTypeDef* hdma2d);
+
+        /**
+         * @brief Get the queued buffer without taking it. Called from the vblank interrupt.
+         * @return Queued buffer, or null when nothing is queued.
+         */
+        const FrameBuffer* peekQueued() const {
+            const uint32_t queued = _queued.load();
+
+            return (queued == NO_BUFFER) ? nullptr : &_buffers[queued];
+        }
+
+        /**
+         * @brief Take the queued buffer for display. Called from the vblank interrupt.
+         * @details Call only after the buffer address has been programmed: from
+         *          here on the previously displayed buffer may be rendered into.
+         * @return Queued buffer, or null when nothing is queued.
+         */
+        const FrameBuffer* takeQueued();
+
+        /**
+         * @brief Add time the render task spent waiting for a buffer.
+         * @param milliseconds Wait time.
+         */
+        void addStallTime(uint32_t milliseconds){
+            _statistics.stallTime += milliseconds;
+        }
+
+        /**
+         * @brief Get frame pacing counters.
+         * @return Statistics since attach or the last reset.
+         */
+        const Statistics& getStatistics() const {
+            return _statistics;
+        }
+
+        /** @brief Reset frame pacing counters. */
+        void resetStatistics();
+    };
+}
+
+#endif // __FRAME_QUEUE_LIB_H__
+
+#endif // __cplusplus
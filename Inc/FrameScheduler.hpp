@@ -0,0 +1,190 @@
+#ifdef __cplusplus
+
+#ifndef __FRAME_SCHEDULER_LIB_H__
+#define __FRAME_SCHEDULER_LIB_H__
+
+/**
+ * @file FrameScheduler.hpp
+ * @brief Coalesces region updates into paced, one-per-vblank presents.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include "ILI9341.hpp"
+
+namespace TFT_LCD {
+    /**
+     * @brief Redraws invalidated screen regions and presents once per frame slot.
+     *
+     * @details
+     * Each region has a draw function and a rate hint: it is redrawn at most
+     * `rate` times per second, either when invalidated (`ON_INVALIDATE`) or
+     * on its own (`PERIODIC`). `runFrame`, called in a loop by the display
+     * task, sleeps until the next frame slot of the target rate, draws every
+     * due region inside one frame transaction and presents once. Regions
+     * that are invalidated more often than their rate are coalesced.
+     *
+     * Time is counted in vertical blanking periods from `waitForVBlank` and
+     * `onLineEvent`. Drawing outside the region callbacks would present on
+     * its own and should be avoided.
+     */
+    class FrameScheduler{
+    public:
+        /** @brief Maximum number of regions. */
+        static const uint32_t MAX_REGIONS {16};
+        /** @brief Returned by `addRegion` when no slot is left. */
+        static const uint32_t NO_REGION {0xFF};
+
+        /** @brief When a region is redrawn. */
+        enum UpdateMode : uint8_t{
+            ON_INVALIDATE   = 0,    /* After `invalidate`, at most at the region rate */
+            PERIODIC        = 1     /* At the region rate without invalidation */
+        };
+
+        /**
+         * @brief Region draw function.
+         * @param display Display to draw on; drawing calls do not present here.
+         * @param area Region rectangle.
+         * @param context Pointer given to `addRegion`.
+         */
+        typedef void (*DrawFunction)(ILI9341& display, const Rect& area, void* context);
+
+        /**
+         * @brief Frame pacing counters.
+         */
+        struct Statistics{
+            /** @brief Frames drawn and presented. */
+            uint32_t presentedFrames;
+            /** @brief Frame slots with nothing to redraw. */
+            uint32_t idleSlots;
+            /** @brief Region draw calls. */
+            uint32_t drawnRegions;
+            /** @brief Frames that were not presented before the next slot. */
+            uint32_t deadlineMisses;
+            /** @brief Frame slots skipped because a frame overran. */
+            uint32_t skippedSlots;
+            /** @brief Time available per frame in milliseconds. */
+            uint32_t frameBudget;
+            /** @brief Draw and present time of the last frame in milliseconds. */
+            uint32_t lastFrameTime;
+            /** @brief Longest draw and present time in milliseconds. */
+            uint32_t maxFrameTime;
+        };
+
+    private:
+        /** @brief Region bookkeeping. */
+        struct Region{
+            Rect area;
+            DrawFunction draw = nullptr;
+            void* context = nullptr;
+            /** @brief Minimum vblanks between two redraws. */
+            uint32_t period = 1;
+            /** @brief VBlank count of the last redraw. */
+            uint32_t lastDraw = 0;
+            UpdateMode mode = ON_INVALIDATE;
+        };
+
+        ILI9341& _display;
+        const uint32_t _refreshRate;
+        /** @brief VBlanks between two frame slots. */
+        uint32_t _interval = 1;
+
+        Region _regions[MAX_REGIONS];
+        uint32_t _regionCount = 0;
+
+        /** @brief Regions invalidated from other tasks or interrupts. */
+        std::atomic<uint32_t> _invalidated {0};
+        /** @brief Invalidated regions waiting for their rate limit. */
+        uint32_t _pending = 0;
+
+        /** @brief VBlanks seen by the scheduler. */
+        uint32_t _vblankCount = 0;
+        /** @brief Last value of `ILI9341::getVBlankCount`. */
+        uint32_t _displayVBlankCount = 0;
+        /** @brief VBlank count of the next frame slot. */
+        uint32_t _nextSlot = 0;
+
+        Statistics _statistics {};
+
+        /**
+         * @brief Bring the vblank count up to date.
+         * @param hasWaited `true` right after a successful `waitForVBlank`;
+         *        counts one vblank when `onLineEvent` is not forwarded.
+         */
+        void updateVBlankCount(bool hasWaited);
+
+        /**
+         * @brief Convert a rate to vblanks.
+         * @param rate Updates per second; 0 for every vblank.
+         * @return Period in vblanks, at least 1.
+         */
+        uint32_t toPeriod(uint32_t rate) const;
+
+    public:
+        /**
+         * @brief Construct scheduler for a display.
+         * @param display Display to present on.
+         * @param refreshRate Panel refresh rate in Hz, given by the LTDC timing.
+         */
+        FrameScheduler(ILI9341& display, uint32_t refreshRate = 60);
+
+        /**
+         * @brief Register a screen region.
+         * @details The region starts invalidated.
+         * @param area Region rectangle, passed to `draw`.
+         * @param draw Draw function.
+         * @param context Pointer passed to `draw`.
+         * @param rate Maximum redraws per second; 0 for no limit.
+         * @param mode Redraw on invalidation or periodically.
+         * @return Region index for `invalidate`, or `NO_REGION`.
+         */
+        uint32_t addRegion(const Rect& area, DrawFunction draw, void* context, uint32_t rate, UpdateMode mode = ON_INVALIDATE);
+
+        /**
+         * @brief Request a redraw of a region.
+         * @details Safe from other tasks and interrupts.
+         * @param region Index returned by `addRegion`.
+         */
+        void invalidate(uint32_t region);
+
+        /** @brief Request a redraw of every region. */
+        void invalidateAll();
+
+        /**
+         * @brief Set the maximum present rate.
+         * @param rate Frames per second; rounded to a divisor of the refresh
+         *        rate, 0 for every vblank.
+         */
+        void setTargetRate(uint32_t rate);
+
+        /**
+         * @brief Get the effective present rate.
+         * @return Frames per second.
+         */
+        uint32_t getTargetRate() const {
+            return _refreshRate / _interval;
+        }
+
+        /**
+         * @brief Wait for the next frame slot and redraw due regions.
+         * @return `true` when a frame was presented, `false` for an idle slot
+         *         or a vblank wait timeout.
+         */
+        bool runFrame();
+
+        /**
+         * @brief Get frame pacing counters.
+         * @return Statistics since construction or the last reset.
+         */
+        const Statistics& getStatistics() const {
+            return _statistics;
+        }
+
+        /** @brief Reset frame pacing counters; the frame budget is kept. */
+        void resetStatistics();
+    };
+}
+
+#endif // __FRAME_SCHEDULER_LIB_H__
+
+#endif // __cplusplus
@@ -0,0 +1,135 @@
+#ifdef __cplusplus
+
+#ifndef __GLYPH_CACHE_LIB_H__
+#define __GLYPH_CACHE_LIB_H__
+
+/**
+ * @file GlyphCache.hpp
+ * @brief LRU cache of pre-rendered, opaque RGB565 glyph cells.
+ */
+
+#include <cstdint>
+#include <string_view>
+#include "FrameBuffer.hpp"
+#include "font/fonts.hpp"
+#include "main.h"
+
+namespace TFT_LCD {
+    /**
+     * @brief Caches expanded `sFONT` glyph cells keyed by font, character and colors.
+     *
+     * @details
+     * The arena is split into equal slots of `slotPixels` pixels. A hit is
+     * drawn with a row copy (or a DMA2D M2M copy when a handle is given);
+     * a miss expands the glyph into the least recently used slot first.
+     * Cells larger than a slot are drawn directly and counted as misses.
+     * The arena must be reachable by DMA2D when a handle is used (not CCM).
+     */
+    class GlyphCache{
+    public:
+        /** @brief Upper bound on the number of cache slots. */
+        static const uint32_t MAX_SLOTS {64};
+
+    private:
+        /** @brief Cache slot bookkeeping. */
+        struct Slot{
+            const sFONT* font = nullptr;
+            uint8_t character = 0;
+            uint16_t color = 0;
+            uint16_t background = 0;
+            uint32_t lastUse = 0;
+        };
+
+        Pixel* const _arena;
+        const uint32_t _slotPixels;
+        uint32_t _slotCount = 0;
+        Slot _slots[MAX_SLOTS];
+
+        uint32_t _useClock = 0;
+        uint32_t _hitCount = 0;
+        uint32_t _missCount = 0;
+
+        DMA2D_HandleTypeDef* const _hdma2d;
+
+        /**
+         * @brief Expand a glyph into an opaque cell.
+         * @param cell Destination cell, `font.Width * font.Height` pixels.
+         * @param pitch Destination line length in pixels.
+         */
+        static void expandGlyph(Pixel* cell, uint32_t pitch, uint8_t character, const sFONT& font, Pixel color, Pixel background);
+
+        /**
+         * @brief Find a cached cell, filling the LRU slot on a miss.
+         * @return Cell pixels, or null when the glyph does not fit a slot.
+         */
+        const Pixel* lookup(uint8_t character, const sFONT& font, Pixel color, Pixel background);
+
+    public:
+        /**
+         * @brief Construct cache over a caller-provided arena.
+         * @param arena RGB565 arena base address.
+         * @param arenaPixels Arena size in pixels.
+         * @param slotPixels Pixels per slot; at least the largest cached cell.
+         * @param hdma2d Optional DMA2D handle used to draw hits.
+         */
+        GlyphCache(uint16_t* arena, uint32_t arenaPixels, uint32_t slotPixels, DMA2D_HandleTypeDef* hdma2d = nullptr);
+
+        /**
+         * @brief Draw an opaque character cell through the cache.
+         * @param target Destination frame buffer.
+         * @param character ASCII character code.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         * @param font Font descriptor.
+         * @param color Glyph color.
+         * @param background Cell background color.
+         */
+        void putChar(FrameBuffer& target, uint8_t character, uint32_t x, uint32_t y, const sFONT& font, Pixel color, Pixel background);
+
+        /**
+         * @brief Draw an opaque text string through the cache.
+         * @param target Destination frame buffer.
+         * @param text ASCII text to render.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         * @param font Font descriptor.
+         * @param color Glyph color.
+         * @param background Cell background color.
+         */
+        void putText(FrameBuffer& target, std::string_view text, uint32_t x, uint32_t y, const sFONT& font, Pixel color, Pixel background);
+
+        /** @brief Drop every cached cell. Counters are kept. */
+        void clear();
+
+        /**
+         * @brief Get number of cells drawn from the cache.
+         * @return Hit count since construction or last reset.
+         */
+        uint32_t getHitCount() const {
+            return _hitCount;
+        }
+
+        /**
+         * @brief Get number of cells that had to be expanded.
+         * @return Miss count since construction or last reset.
+         */
+        uint32_t getMissCount() const {
+            return _missCount;
+        }
+
+        /**
+         * @brief Get number of usable slots.
+         * @return Slot count derived from the arena and slot size.
+         */
+        uint32_t getSlotCount() const {
+            return _slotCount;
+        }
+
+        /** @brief Reset hit and miss counters. */
+        void resetStatistics();
+    };
+}
+
+#endif // __GLYPH_CACHE_LIB_H__
+
+#endif // __cplusplus
@@ -18,6 +18,15 @@
 #include "main.h"
 
 #include "FrameBuffer.hpp"
+#include "DamageList.hpp"
+#include "FrameQueue.hpp"
+#include "GlyphCache.hpp"
+#include "TextLayout.hpp"
+#include "TextLabel.hpp"
+#include "DisplayList.hpp"
+#include "TileRenderer.hpp"
+#include "VirtualCanvas.hpp"
+#include "Dma2dQueue.hpp"
 
 #include <array>
 #include <span>
@@ -25,6 +34,11 @@
 // #define USE_HAL
 #define USE_FREERTOS
 
+#ifdef USE_FREERTOS
+#include "FreeRTOS.h"
+#include "semphr.h"
+#endif
+
 namespace TFT_LCD {
     /**
      * @brief Hardware resources required by the ILI9341 driver.
@@ -63,6 +77,22 @@ namespace TFT_LCD {
         static const uint32_t LCD_HEIGHT {320};
         /** @brief Number of bytes per RGB565 pixel. */
         static const uint32_t PIXEL_BYTE_COUNT {2};
+        /** @brief Width of the reduced-resolution render target. */
+        static const uint32_t LOW_RES_WIDTH {LCD_WIDTH / 2};
+        /** @brief Height of the reduced-resolution render target. */
+        static const uint32_t LOW_RES_HEIGHT {LCD_HEIGHT / 2};
+
+        /** @brief Screen transition effects. */
+        enum TransitionEffect : uint8_t{
+            CROSS_FADE          = 0,    /* Layer 1 constant alpha */
+            CROSS_FADE_DMA2D    = 1,    /* DMA2D blend into the frame buffer */
+            SLIDE_LEFT          = 2,    /* Layer 1 window enters from the right */
+            SLIDE_RIGHT         = 3,    /* Layer 1 window enters from the left */
+            SLIDE_UP            = 4,    /* Layer 1 window enters from the bottom */
+            SLIDE_DOWN          = 5,    /* Layer 1 window enters from the top */
+            WIPE_RIGHT          = 6,    /* Column strips copied left to right */
+            WIPE_DOWN           = 7     /* Row strips copied top to bottom */
+        };
     private:
         /** 
         * @brief  ILI9341 Registers  
@@ -158,7 +188,11 @@ namespace TFT_LCD {
         };
 
         /** @brief Number of internal frame-buffer slots used by the driver. */
-        static const uint32_t FRAME_BUFFER_COUNT = 2;
+        static const uint32_t FRAME_BUFFER_COUNT = FrameQueue::MAX_BUFFERS;
+        /** @brief Longest wait for a free buffer in queued mode, in milliseconds. */
+        static const uint32_t FRAME_QUEUE_TIMEOUT {100};
+        /** @brief Longest beam-racing wait for the scan line, in milliseconds. */
+        static const uint32_t BEAM_WAIT_TIMEOUT {50};
 
         /** @brief Internal frame-buffer descriptors (front/back). */
         FrameBuffer _FrameBuffer[FRAME_BUFFER_COUNT];
@@ -170,6 +204,98 @@ namespace TFT_LCD {
         bool _hasBackFrame = false;
         /** @brief Prevents duplicate update on already swapped frame. */
         bool _isUpdatedRecently = false;
+        /** @brief Areas drawn into the back buffer since the last swap. */
+        DamageList _damage{LCD_WIDTH, LCD_HEIGHT};
+        /** @brief Buffer exchange with the vblank handler in queued mode. */
+        FrameQueue _frameQueue;
+
+        /** @brief Progress of an asynchronous present. */
+        enum PresentState : uint8_t{
+            PRESENT_IDLE            = 0,    /* Nothing in flight */
+            PRESENT_WAITING_RELOAD  = 1,    /* Address change waits for vertical blanking */
+            PRESENT_COPYING         = 2     /* DMA2D copies damaged areas back */
+        };
+
+        /** @brief Copy back through DMA2D interrupts instead of blocking. */
+        bool _isAsyncPresent = false;
+        /** @brief Current asynchronous present step, advanced from interrupts. */
+        volatile PresentState _presentState = PRESENT_IDLE;
+        /** @brief Areas being copied back by the asynchronous present. */
+        DamageList _copyBack{LCD_WIDTH, LCD_HEIGHT};
+        /** @brief Next `_copyBack` rectangle to start. */
+        uint32_t _copyBackIndex = 0;
+
+        /** @brief Vertical blanking periods reported through `onLineEvent`. */
+        volatile uint32_t _vblankCount = 0;
+        /** @brief LTDC line the line event is currently programmed for. */
+        volatile uint32_t _lineEventLine = 0;
+
+        /** @brief Nesting depth of `beginFrame`; draws do not present while non-zero. */
+        uint32_t _frameDepth = 0;
+
+        /** @brief Draw into the single buffer only while the scan line is elsewhere. */
+        bool _isBeamRacing = false;
+        /** @brief Lines the scan line must stay away from a region before drawing it. */
+        uint32_t _beamMarginLines = 16;
+        /** @brief Drawing calls that had to wait for the scan line. */
+        uint32_t _beamWaitCount = 0;
+
+        /** @brief Frame buffer scanned out by LTDC layer 1. */
+        FrameBuffer _overlay;
+        /** @brief Indicates whether layer 1 is configured. */
+        bool _hasOverlay = false;
+        /** @brief Left pixel position of the layer 1 window. */
+        uint32_t _overlayLeft = 0;
+        /** @brief Top pixel position of the layer 1 window. */
+        uint32_t _overlayTop = 0;
+        /** @brief Constant alpha of layer 1. */
+        uint8_t _overlayAlpha = 255;
+        /** @brief Indicates whether the overlay color key is enabled. */
+        bool _isOverlayColorKeyed = false;
+        /** @brief Transparent overlay color. */
+        Pixel _overlayColorKey;
+
+        /** @brief Asynchronous DMA2D jobs drawing into the frame buffers. */
+        Dma2dQueue _dma2dQueue;
+
+        /** @brief Quarter-size render target of the low-resolution mode. */
+        FrameBuffer _lowRes;
+        /** @brief Indicates whether the low-resolution mode is enabled. */
+        bool _isLowResolution = false;
+
+        /** @brief Surface shown before the running transition. */
+        const FrameBuffer* _transitionFrom = nullptr;
+        /** @brief Surface shown after the running transition. */
+        const FrameBuffer* _transitionTo = nullptr;
+        /** @brief Effect of the running transition. */
+        TransitionEffect _transitionEffect = CROSS_FADE;
+        /** @brief Length of the running transition in frames; 0 when idle. */
+        uint32_t _transitionFrames = 0;
+        /** @brief Frames of the running transition done so far. */
+        uint32_t _transitionStep = 0;
+#ifdef USE_FREERTOS
+        /** @brief Given by `onReloadEvent` when a shadow reload completes. */
+        SemaphoreHandle_t _reloadSemaphore = nullptr;
+        StaticSemaphore_t _reloadSemaphoreBuffer;
+        /** @brief Given when an asynchronous present has finished. */
+        SemaphoreHandle_t _presentSemaphore = nullptr;
+        StaticSemaphore_t _presentSemaphoreBuffer;
+        /** @brief Given by `onLineEvent` whenever the programmed line is reached. */
+        SemaphoreHandle_t _lineEventSemaphore = nullptr;
+        StaticSemaphore_t _lineEventSemaphoreBuffer;
+        /** @brief Held by a task waiting on the line event, so it is not reprogrammed under it. */
+        SemaphoreHandle_t _lineEventMutex = nullptr;
+        StaticSemaphore_t _lineEventMutexBuffer;
+        /** @brief Given on every DMA2D interrupt; job queue waits sleep on it. */
+        SemaphoreHandle_t _dma2dSemaphore = nullptr;
+        StaticSemaphore_t _dma2dSemaphoreBuffer;
+
+        /**
+         * @brief DMA2D wait handler: sleep until the next DMA2D interrupt.
+         * @param context The driver.
+         */
+        static void waitForDma2d(void* context);
+#endif
     private:
         /** @brief Immutable driver configuration set at construction. */
         const ILI9341_Config config;
@@ -194,12 +320,158 @@ namespace TFT_LCD {
 
         /**
          * @brief Configure LTDC layer from a frame buffer.
+         * @details Full layer setup; used at initialization. Buffer swaps go
+         *          through `presentFrameBuffer`.
          * @param layerIndex LTDC layer index.
          * @param frameBuffer Source frame buffer.
          * @param left Left pixel position of the layer window.
          * @param top Top pixel position of the layer window.
+         * @param alpha Layer constant alpha.
+         */
+        void setLayer(uint32_t layerIndex,const FrameBuffer& frameBuffer, uint32_t left = 0,uint32_t top = 0,uint8_t alpha = 255);
+
+        /**
+         * @brief Point layer 0 at another frame buffer of the same geometry.
+         * @details Writes the start address and line pitch with `setScanoutAddress`;
+         *          the shadow registers are reloaded at the next vertical blanking.
+         * @param frameBuffer Frame buffer to scan out.
+         */
+        void presentFrameBuffer(const FrameBuffer& frameBuffer);
+
+        /**
+         * @brief Write the layer 0 start address and line pitch registers.
+         * @details Writes `CFBAR` and `CFBLR` directly instead of going through
+         *          the HAL, which rewrites every layer register and takes the
+         *          handle lock. Safe to call from interrupt context. Takes
+         *          effect at the next shadow reload.
+         * @param address First pixel scanned out.
+         * @param pitch Line pitch in pixels.
+         */
+        void setScanoutAddress(const void* address,uint32_t pitch);
+
+        /**
+         * @brief Latch the LTDC shadow registers at the next vertical blanking.
+         * @details Enables the reload interrupt and writes `SRCR` directly.
+         */
+        void reloadOnVBlank();
+
+        /** @brief Give layer 1 back to the overlay, or disable it. */
+        void restoreOverlay();
+
+        /**
+         * @brief Check whether a transition effect runs on layer 1.
+         * @param effect Transition effect.
+         * @return `true` for fades and slides done by LTDC.
+         */
+        static bool isLayerTransition(TransitionEffect effect);
+
+        /**
+         * @brief Show part of the target surface in a layer 1 window.
+         * @param left Left pixel position of the window.
+         * @param top Top pixel position of the window.
+         * @param width Window width in pixels.
+         * @param height Window height in pixels.
+         * @param source First surface pixel shown in the window.
+         */
+        void setTransitionWindow(uint32_t left,uint32_t top,uint32_t width,uint32_t height,const Pixel* source);
+
+        /** @brief Leave the final surface in the driver frame buffers and end the transition. */
+        void finishTransition();
+
+        /**
+         * @brief Check whether a vertical-blanking reload is still pending.
+         * @return `true` while LTDC has not latched the shadow registers.
+         */
+        bool isReloadPending() const;
+
+        /**
+         * @brief Check whether LTDC is currently outside the active display lines.
+         * @return `true` during vertical sync, back porch and front porch.
+         */
+        bool isInVBlank() const;
+
+        /**
+         * @brief Get the first LTDC line after the active area.
+         * @return Line number in LTDC total-line coordinates.
+         */
+        uint32_t getVBlankLine() const;
+
+        /**
+         * @brief Arm the LTDC line interrupt.
+         * @details Writes `LIPCR` and `IER` directly, so it cannot fail on the
+         *          HAL lock and may be called from interrupt context.
+         * @param line Line number in LTDC total-line coordinates.
+         */
+        void programLineEvent(uint32_t line);
+
+        /**
+         * @brief Wait until the scan line is clear of a band of display rows.
+         * @details Returns when the beam has passed the band, or is at least
+         *          `_beamMarginLines` above it, at most one frame later. Under
+         *          FreeRTOS it sleeps on line events while holding the line
+         *          event mutex and re-arms the vblank line before returning;
+         *          otherwise it busy-polls the scan line. Gives up after
+         *          `BEAM_WAIT_TIMEOUT` milliseconds when LTDC is not scanning.
+         * @param top First row of the band.
+         * @param height Number of rows in the band.
+         */
+        void waitForScanOutside(uint32_t top, uint32_t height);
+
+        /**
+         * @brief Block until the pending shadow reload has been applied.
+         * @details Sleeps on the reload semaphore under FreeRTOS, busy-waits otherwise.
+         */
+        void waitForReload();
+
+        /**
+         * @brief Start the next asynchronous copy-back transfer.
+         * @return `false` when no transfer is left to start.
+         */
+        bool startNextCopyBack();
+
+        /**
+         * @brief Finish an asynchronous present and wake the waiting task.
+         * @details Called from interrupt context.
+         */
+        void finishPresent();
+
+        /**
+         * @brief Queue the render buffer and acquire a free one (queued mode).
+         * @details Waits for a vblank only when no buffer is free. After
+         *          `FRAME_QUEUE_TIMEOUT` milliseconds without one the queued
+         *          frame is taken back as render buffer (dropped) and the
+         *          vblank line event is re-armed.
+         * @return `false` when the frame was dropped on timeout.
          */
-        void setLayer(uint32_t layerIndex,const FrameBuffer& frameBuffer, uint32_t left = 0,uint32_t top = 0);
+        bool submitQueuedFrame();
+
+        /**
+         * @brief Get the frame buffer that drawing calls render into.
+         * @details Waits for a running asynchronous present first.
+         * @return Back buffer when double buffering, otherwise the front buffer.
+         */
+        FrameBuffer& getDrawingFrameBuffer();
+
+        /**
+         * @brief Get the drawing target for a rectangle.
+         * @details Waits only for DMA2D jobs that overlap the rectangle. In
+         *          beam-racing mode also waits for the scan line to leave its rows.
+         * @param area Pixels the drawing call touches.
+         * @return Frame buffer to draw into.
+         */
+        FrameBuffer& beginDrawing(const Rect& area);
+
+        /**
+         * @brief Record an area drawn into the back buffer.
+         * @param area Modified rectangle; copied back to the other buffer after the next swap.
+         */
+        void markDamaged(const Rect& area);
+
+        /**
+         * @brief Mark the drawing buffer modified and present it if requested.
+         * @param update Swap/present immediately when back buffer is enabled.
+         */
+        void finishDrawing(bool update);
     public:
         /**
          * @brief Construct ILI9341 driver instance.
@@ -219,6 +491,279 @@ namespace TFT_LCD {
          */
         void setBackFrameBuffer(uint16_t* FrameBufferAddress);
 
+        /**
+         * @brief Register back buffers for queued (N-buffer) presentation.
+         * @details With two back buffers (triple buffering) rendering never
+         *          waits for the display: one buffer is shown, one is queued
+         *          and one is drawn. A queued frame that is replaced before
+         *          vblank is dropped. Buffers are exchanged in `onLineEvent`,
+         *          which must be forwarded. `setAsyncPresent` has no effect
+         *          in this mode.
+         * @param backFrameBuffers One or two RGB565 back-buffer base addresses.
+         */
+        void setQueuedFrameBuffers(std::span<uint16_t* const> backFrameBuffers);
+
+        /**
+         * @brief Get frame time and dropped-frame counters of the queued mode.
+         * @return Statistics since `setQueuedFrameBuffers` or the last reset.
+         */
+        const FrameQueue::Statistics& getFrameStatistics() const {
+            return _frameQueue.getStatistics();
+        }
+
+        /** @brief Reset the queued-mode frame statistics. */
+        void resetFrameStatistics(){
+            _frameQueue.resetStatistics();
+        }
+
+        /**
+         * @brief Queue a filled rectangle on DMA2D.
+         * @details Returns once the job is queued. CPU drawing calls wait only
+         *          for queued jobs that touch their rows, and presents wait for
+         *          all of them, so inside `beginFrame`/`endFrame` the CPU keeps
+         *          drawing while DMA2D works. Requires a DMA2D handle and
+         *          `onDma2dTransferComplete`; beam racing does not apply.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         * @param width Rectangle width in pixels.
+         * @param height Rectangle height in pixels.
+         * @param color Fill color in RGB565.
+         * @param update Swap/present immediately when back buffer is enabled;
+         *        this waits for the queue.
+         * @return Fence of the job.
+         */
+        Dma2dQueue::Fence drawRectangleAsync(uint32_t x, uint32_t y, uint32_t width, uint32_t height, Pixel color,bool update = true);
+
+        /**
+         * @brief Queue an RGB565 copy into the frame buffer on DMA2D.
+         * @details See `drawRectangleAsync`.
+         * @param source Source frame buffer; must stay unchanged until the fence completes.
+         * @param area Source rectangle.
+         * @param x Destination left pixel coordinate.
+         * @param y Destination top pixel coordinate.
+         * @param update Swap/present immediately when back buffer is enabled.
+         * @return Fence of the job.
+         */
+        Dma2dQueue::Fence copyRectAsync(const FrameBuffer& source,const Rect& area,uint32_t x,uint32_t y,bool update = true);
+
+        /**
+         * @brief Queue drawing of an image in another pixel format on DMA2D.
+         * @details The image is converted to RGB565. See `drawRectangleAsync`.
+         * @param pixels First image pixel; must stay valid until the fence completes.
+         * @param pitch Image line length in pixels.
+         * @param inputColorMode DMA2D color mode of the image, e.g. `DMA2D_INPUT_ARGB8888`.
+         * @param area Destination rectangle.
+         * @param update Swap/present immediately when back buffer is enabled.
+         * @return Fence of the job.
+         */
+        Dma2dQueue::Fence drawImageAsync(const void* pixels,uint32_t pitch,uint32_t inputColorMode,const Rect& area,bool update = true);
+
+        /**
+         * @brief Queue a constant-alpha blend into the frame buffer on DMA2D.
+         * @details See `drawRectangleAsync`.
+         * @param source Foreground frame buffer; must stay unchanged until the fence completes.
+         * @param area Foreground rectangle.
+         * @param alpha Foreground opacity, 0 to 255.
+         * @param x Destination left pixel coordinate.
+         * @param y Destination top pixel coordinate.
+         * @param update Swap/present immediately when back buffer is enabled.
+         * @return Fence of the job.
+         */
+        Dma2dQueue::Fence blendRectAsync(const FrameBuffer& source,const Rect& area,uint8_t alpha,uint32_t x,uint32_t y,bool update = true);
+
+        /**
+         * @brief Get the DMA2D job queue, e.g. to wait on fences.
+         * @return Driver job queue.
+         */
+        Dma2dQueue& getDma2dQueue(){
+            return _dma2dQueue;
+        }
+
+        /**
+         * @brief Enable or disable the reduced-resolution render mode.
+         * @details The application draws a `LOW_RES_WIDTH` x `LOW_RES_HEIGHT`
+         *          scene into `getLowResFrameBuffer` and shows it with
+         *          `presentLowResolution`, which scales it up 2x into the
+         *          frame buffer. While enabled, frames must be presented with
+         *          `presentLowResolution`: double-buffered swaps skip the
+         *          copy-back, which is done once when the mode is disabled.
+         * @param FrameBufferAddress RGB565 buffer of `LOW_RES_WIDTH * LOW_RES_HEIGHT`
+         *        pixels, or null to disable the mode.
+         */
+        void setLowResolution(uint16_t* FrameBufferAddress);
+
+        /**
+         * @brief Check whether the reduced-resolution mode is enabled.
+         * @return `true` after `setLowResolution` with a buffer.
+         */
+        bool isLowResolution() const {
+            return _isLowResolution;
+        }
+
+        /**
+         * @brief Get the reduced-resolution render target.
+         * @return Quarter-size frame buffer.
+         */
+        FrameBuffer& getLowResFrameBuffer(){
+            return _lowRes;
+        }
+
+        /**
+         * @brief Scale the reduced-resolution scene up 2x and present it.
+         * @details Full-resolution content such as text can be drawn on top
+         *          from a display list, or kept on the layer 1 overlay.
+         * @param overlay Optional display list replayed at full resolution
+         *        after scaling.
+         * @param update Swap/present immediately when back buffer is enabled.
+         */
+        void presentLowResolution(const DisplayList* overlay = nullptr,bool update = true);
+
+        /**
+         * @brief Show the current view of a virtual canvas on layer 0.
+         * @details Waits for an asynchronous present and queued DMA2D jobs,
+         *          duplicates the rows revealed by the last `scroll`, then only the layer start address and line pitch registers
+         *          are written; they take effect at the next vertical blanking.
+         *          The next `updateFrame` or `hideCanvas` shows the regular
+         *          frame buffers again. Not available in queued mode
+         *          (`setQueuedFrameBuffers`), where every vblank may program
+         *          the next queued frame over the canvas.
+         * @param canvas Canvas with a view of `LCD_WIDTH` x `LCD_HEIGHT` pixels.
+         */
+        void showCanvas(VirtualCanvas& canvas);
+
+        /** @brief Point layer 0 back at the displayed frame buffer. */
+        void hideCanvas();
+
+        /**
+         * @brief Attach a frame buffer to LTDC layer 1 as an overlay.
+         * @details The overlay is blended over layer 0 with a constant alpha,
+         *          starts fully opaque at the given position, and is cleared.
+         *          It is single buffered: drawing into it shows immediately.
+         * @param FrameBufferAddress RGB565 overlay buffer, `width * height` pixels.
+         * @param width Overlay width in pixels.
+         * @param height Overlay height in pixels.
+         * @param left Left pixel position of the overlay window.
+         * @param top Top pixel position of the overlay window.
+         */
+        void setOverlay(uint16_t* FrameBufferAddress,uint32_t width,uint32_t height,uint32_t left = 0,uint32_t top = 0);
+
+        /**
+         * @brief Check whether an overlay is configured.
+         * @return `true` after `setOverlay`.
+         */
+        bool hasOverlay() const {
+            return _hasOverlay;
+        }
+
+        /**
+         * @brief Get the overlay frame buffer for drawing.
+         * @return Layer 1 frame buffer.
+         */
+        FrameBuffer& getOverlayFrameBuffer(){
+            return _overlay;
+        }
+
+        /**
+         * @brief Move the overlay window.
+         * @details Only the layer 1 window registers are written; the move
+         *          takes effect at the next vertical blanking. No pixels are
+         *          redrawn in either layer. The position is clamped so the
+         *          window stays on screen.
+         * @param left Left pixel position of the overlay window.
+         * @param top Top pixel position of the overlay window.
+         */
+        void moveOverlay(uint32_t left,uint32_t top);
+
+        /**
+         * @brief Get the left position of the overlay window.
+         * @return Left pixel position after clamping.
+         */
+        uint32_t getOverlayLeft() const {
+            return _overlayLeft;
+        }
+
+        /**
+         * @brief Get the top position of the overlay window.
+         * @return Top pixel position after clamping.
+         */
+        uint32_t getOverlayTop() const {
+            return _overlayTop;
+        }
+
+        /**
+         * @brief Set the overlay constant alpha.
+         * @details Takes effect at the next vertical blanking; call once per
+         *          frame with changing values to fade the overlay.
+         * @param alpha Opacity, 0 (transparent) to 255 (opaque).
+         */
+        void setOverlayAlpha(uint8_t alpha);
+
+        /**
+         * @brief Get the overlay constant alpha.
+         * @return Opacity, 0 to 255.
+         */
+        uint8_t getOverlayAlpha() const {
+            return _overlayAlpha;
+        }
+
+        /**
+         * @brief Make one overlay color transparent.
+         * @details Overlay pixels of this color show layer 0 underneath, so
+         *          the overlay can have an arbitrary shape.
+         * @param key Transparent color in RGB565.
+         */
+        void setOverlayColorKey(Pixel key);
+
+        /** @brief Stop treating the color key as transparent. */
+        void disableOverlayColorKey();
+
+        /**
+         * @brief Show or hide the overlay.
+         * @param visible `true` to enable layer 1 at the next vertical blanking.
+         */
+        void setOverlayVisible(bool visible);
+
+        /**
+         * @brief Start a transition between two full-screen surfaces.
+         * @details The screen must show `from` when the transition starts.
+         *          Fades and slides show `to` on layer 1 and only write layer
+         *          registers per frame. `CROSS_FADE_DMA2D` blends both surfaces
+         *          into the frame buffer and wipes copy one strip of `to` per
+         *          frame; both present like normal drawing calls. In the end
+         *          `to` is in the driver frame buffers and the overlay is
+         *          restored. Do not draw while a transition runs.
+         * @param from Surface on screen; read only by `CROSS_FADE_DMA2D`.
+         * @param to Surface to show; must stay valid until the transition ends.
+         * @param effect Transition effect; `CROSS_FADE_DMA2D` falls back to
+         *        `CROSS_FADE` without a DMA2D handle.
+         * @param frames Transition length in vertical blanking periods.
+         */
+        void startTransition(const FrameBuffer& from,const FrameBuffer& to,TransitionEffect effect,uint32_t frames);
+
+        /**
+         * @brief Advance the running transition by one frame.
+         * @details Call once per vertical blanking, e.g. after `waitForVBlank`.
+         * @return `true` while further steps are needed.
+         */
+        bool stepTransition();
+
+        /**
+         * @brief Run a whole transition, one step per vertical blanking.
+         * @param from Surface on screen.
+         * @param to Surface to show.
+         * @param effect Transition effect.
+         * @param frames Transition length in vertical blanking periods.
+         */
+        void runTransition(const FrameBuffer& from,const FrameBuffer& to,TransitionEffect effect,uint32_t frames);
+
+        /**
+         * @brief Check whether a transition is running.
+         * @return `true` between `startTransition` and the last step.
+         */
+        bool isTransitionRunning() const {
+            return _transitionFrames != 0;
+        }
+
         /**
          * @brief Draw a filled rectangle.
          * @param x Left pixel coordinate.
@@ -239,7 +784,7 @@ namespace TFT_LCD {
          * @param color Text color in RGB565.
          * @param update Swap/present immediately when back buffer is enabled.
          */
-        void putText(std::string text, uint32_t x,uint32_t y,const sFONT& font,Pixel color,bool update = true);
+        void putText(std::string_view text, uint32_t x,uint32_t y,const sFONT& font,Pixel color,bool update = true);
         /**
          * @brief Draw a single character.
          * @param character ASCII character code.
@@ -251,11 +796,337 @@ namespace TFT_LCD {
          */
         void putChar(uint8_t character,uint32_t x,uint32_t y,const sFONT& font,Pixel color,bool update = true);
 
+        /**
+         * @brief Draw a text string magnified by an integer factor.
+         * @param text Text to render.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         * @param font Font resource descriptor.
+         * @param color Text color in RGB565.
+         * @param scale Integer magnification, 1 or more.
+         * @param update Swap/present immediately when back buffer is enabled.
+         */
+        void putTextScaled(std::string_view text, uint32_t x,uint32_t y,const sFONT& font,Pixel color,uint32_t scale,bool update = true);
+        /**
+         * @brief Draw a single character magnified by an integer factor.
+         * @param character ASCII character code.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         * @param font Font resource descriptor.
+         * @param color Glyph color in RGB565.
+         * @param scale Integer magnification, 1 or more.
+         * @param update Swap/present immediately when back buffer is enabled.
+         */
+        void putCharScaled(uint8_t character,uint32_t x,uint32_t y,const sFONT& font,Pixel color,uint32_t scale,bool update = true);
+
+        /**
+         * @brief Draw an integer or fixed-point number without string formatting.
+         * @param value Number to draw, scaled by `10^format.decimals`.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         * @param font Font resource descriptor.
+         * @param color Text color in RGB565.
+         * @param format Field width, decimals, padding and sign.
+         * @param update Swap/present immediately when back buffer is enabled.
+         */
+        void putNumber(int32_t value, uint32_t x,uint32_t y,const sFONT& font,Pixel color,NumberFormat format = {},bool update = true);
+        /**
+         * @brief Draw an integer or fixed-point number with a compact font.
+         * @param value Number to draw, scaled by `10^format.decimals`.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         * @param font Compact font descriptor.
+         * @param color Text color in RGB565.
+         * @param format Field width, decimals, padding and sign.
+         * @param update Swap/present immediately when back buffer is enabled.
+         */
+        void putNumber(int32_t value, uint32_t x,uint32_t y,const CompactFont& font,Pixel color,NumberFormat format = {},bool update = true);
+
+        /**
+         * @brief Draw a precomputed text layout.
+         * @param layout Laid out text.
+         * @param color Text color in RGB565.
+         * @param update Swap/present immediately when back buffer is enabled.
+         */
+        void putText(const TextLayout& layout,Pixel color,bool update = true);
+
+        /**
+         * @brief Update a text label, repainting only the changed cells.
+         * @param label Label that remembers the previously drawn text.
+         * @param text New label text.
+         * @param update Swap/present immediately when back buffer is enabled.
+         */
+        void putText(TextLabel& label,std::string_view text,bool update = true);
+
+        /**
+         * @brief Replay a recorded display list.
+         * @details Commands go through the normal drawing calls, so damage
+         *          tracking applies, but the list presents at most once.
+         * @param list Display list to replay.
+         * @param update Swap/present immediately when back buffer is enabled.
+         */
+        void drawDisplayList(const DisplayList& list,bool update = true);
+
+        /**
+         * @brief Render a display list tile by tile.
+         * @details Overlapping commands are composed in the renderer's tile
+         *          buffer and each touched tile is written to the frame buffer
+         *          once. The written tiles are marked damaged.
+         * @param list Display list to render.
+         * @param renderer Tile renderer owning the tile buffer.
+         * @param update Swap/present immediately when back buffer is enabled.
+         */
+        void drawDisplayList(const DisplayList& list,TileRenderer& renderer,bool update = true);
+
+        /**
+         * @brief Draw an opaque text string through a glyph cache.
+         * @param text Text to render.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         * @param font Font resource descriptor.
+         * @param color Text color in RGB565.
+         * @param background Cell background color in RGB565.
+         * @param cache Glyph cache that holds the expanded cells.
+         * @param update Swap/present immediately when back buffer is enabled.
+         */
+        void putText(std::string_view text, uint32_t x,uint32_t y,const sFONT& font,Pixel color,Pixel background,GlyphCache& cache,bool update = true);
+        /**
+         * @brief Draw an opaque character cell through a glyph cache.
+         * @param character ASCII character code.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         * @param font Font resource descriptor.
+         * @param color Glyph color in RGB565.
+         * @param background Cell background color in RGB565.
+         * @param cache Glyph cache that holds the expanded cells.
+         * @param update Swap/present immediately when back buffer is enabled.
+         */
+        void putChar(uint8_t character,uint32_t x,uint32_t y,const sFONT& font,Pixel color,Pixel background,GlyphCache& cache,bool update = true);
+
+        /**
+         * @brief Draw a text string with a proportional font.
+         * @param text Text to render.
+         * @param x Left pixel coordinate of the pen.
+         * @param y Top pixel coordinate.
+         * @param font Proportional font descriptor.
+         * @param color Text color in RGB565.
+         * @param update Swap/present immediately when back buffer is enabled.
+         */
+        void putText(std::string_view text, uint32_t x,uint32_t y,const ProportionalFont& font,Pixel color,bool update = true);
+        /**
+         * @brief Draw a single character with a proportional font.
+         * @param codepoint Unicode code point.
+         * @param x Left pixel coordinate of the pen.
+         * @param y Top pixel coordinate.
+         * @param font Proportional font descriptor.
+         * @param color Glyph color in RGB565.
+         * @param update Swap/present immediately when back buffer is enabled.
+         */
+        void putChar(uint32_t codepoint,uint32_t x,uint32_t y,const ProportionalFont& font,Pixel color,bool update = true);
+
+        /**
+         * @brief Draw a text string with an anti-aliased font.
+         * @details Large glyphs are blended with the configured DMA2D handle.
+         * @param text Text to render.
+         * @param x Left pixel coordinate of the pen.
+         * @param y Top pixel coordinate.
+         * @param font Anti-aliased font descriptor.
+         * @param color Text color in RGB565.
+         * @param update Swap/present immediately when back buffer is enabled.
+         */
+        void putText(std::string_view text, uint32_t x,uint32_t y,const AntiAliasedFont& font,Pixel color,bool update = true);
+        /**
+         * @brief Draw a single character with an anti-aliased font.
+         * @param codepoint Unicode code point.
+         * @param x Left pixel coordinate of the pen.
+         * @param y Top pixel coordinate.
+         * @param font Anti-aliased font descriptor.
+         * @param color Glyph color in RGB565.
+         * @param update Swap/present immediately when back buffer is enabled.
+         */
+        void putChar(uint32_t codepoint,uint32_t x,uint32_t y,const AntiAliasedFont& font,Pixel color,bool update = true);
+
+        /**
+         * @brief Draw a text string with a compact font.
+         * @param text Text to render.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         * @param font Compact font descriptor.
+         * @param color Text color in RGB565.
+         * @param update Swap/present immediately when back buffer is enabled.
+         */
+        void putText(std::string_view text, uint32_t x,uint32_t y,const CompactFont& font,Pixel color,bool update = true);
+        /**
+         * @brief Draw a single character with a compact font.
+         * @param codepoint Unicode code point.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         * @param font Compact font descriptor.
+         * @param color Glyph color in RGB565.
+         * @param update Swap/present immediately when back buffer is enabled.
+         */
+        void putChar(uint32_t codepoint,uint32_t x,uint32_t y,const CompactFont& font,Pixel color,bool update = true);
+
+        /**
+         * @brief Start composing a frame.
+         * @details Until the matching `endFrame`, drawing calls only accumulate
+         *          damage and their `update` argument is ignored. Calls nest;
+         *          the outermost `endFrame` presents.
+         */
+        void beginFrame();
+
+        /**
+         * @brief Finish composing a frame and present it once.
+         * @return `true` when the outermost frame ended and was swapped.
+         */
+        bool endFrame();
+
+        /**
+         * @brief Check whether a frame transaction is open.
+         * @return `true` between `beginFrame` and the outermost `endFrame`.
+         */
+        bool isInFrame() const {
+            return _frameDepth != 0;
+        }
+
         /**
          * @brief Present back buffer and synchronize frame contents.
+         * @details The address change takes effect at the next vertical
+         *          blanking; this call waits for it before copying the areas
+         *          drawn since the last swap back into the new back buffer,
+         *          so the buffer being scanned out is never written.
+         *          In queued mode the frame is queued instead; `false` is also
+         *          returned when it was dropped because no vblank arrived
+         *          within `FRAME_QUEUE_TIMEOUT`.
          * @return `true` when frame was swapped, otherwise `false`.
          */
         bool updateFrame();
+
+        /**
+         * @brief Enable or disable the asynchronous present.
+         * @details When enabled and a DMA2D handle is configured, `updateFrame`
+         *          returns right after requesting the swap. The copy-back runs
+         *          from the LTDC reload and DMA2D transfer-complete interrupts;
+         *          the next drawing call waits for it. Requires `onReloadEvent`
+         *          and `onDma2dTransferComplete` (and `onDma2dTransferError`)
+         *          to be forwarded.
+         * @param enable `true` to return from `updateFrame` without waiting.
+         */
+        void setAsyncPresent(bool enable);
+
+        /**
+         * @brief Check whether an asynchronous present is still running.
+         * @return `true` until the copy-back has finished.
+         */
+        bool isPresentPending() const {
+            return _presentState != PRESENT_IDLE;
+        }
+
+        /**
+         * @brief Block until a running asynchronous present has finished.
+         * @details Sleeps on a semaphore under FreeRTOS, busy-waits otherwise.
+         */
+        void waitForPresent();
+
+        /**
+         * @brief Wait for the start of the next vertical blanking period.
+         * @details Under FreeRTOS the calling task sleeps until `onLineEvent`
+         *          is called from the LTDC line interrupt. Without FreeRTOS the
+         *          LTDC line position is polled.
+         * @param timeout Maximum wait in milliseconds.
+         * @return `true` when vertical blanking started, `false` on timeout.
+         */
+        bool waitForVBlank(uint32_t timeout = 100);
+
+        /**
+         * @brief Get number of vertical blanking periods seen by `onLineEvent`.
+         * @return VBlank counter; wraps around.
+         */
+        uint32_t getVBlankCount() const {
+            return _vblankCount;
+        }
+
+        /**
+         * @brief Enable or disable beam racing in single-buffer mode.
+         * @details Each drawing call waits until the LTDC scan line is outside
+         *          the rows it touches, so updates do not tear without a back
+         *          buffer. Waits sleep on line events, so `onLineEvent` should
+         *          be forwarded. Ignored while a back buffer is configured.
+         * @param enable `true` to race the beam.
+         * @param marginLines Lines the scan line must stay above a region
+         *        for the draw to start before the beam reaches it.
+         */
+        void setBeamRacing(bool enable, uint32_t marginLines = 16);
+
+        /**
+         * @brief Get number of drawing calls that had to wait for the scan line.
+         * @return Beam-racing wait counter.
+         */
+        uint32_t getBeamWaitCount() const {
+            return _beamWaitCount;
+        }
+
+        /**
+         * @brief Notify the driver that an LTDC shadow reload completed.
+         * @details Call from `HAL_LTDC_ReloadEventCallback`.
+         */
+        void onReloadEvent();
+
+        /**
+         * @brief Notify the driver that the programmed LTDC line was reached.
+         * @details Call from `HAL_LTDC_LineEventCallback`. In queued mode this
+         *          also shows the queued buffer and re-arms the line event.
+         */
+        void onLineEvent();
+
+        /**
+         * @brief Notify the driver that a DMA2D transfer completed.
+         * @details Call from the `XferCpltCallback` of the DMA2D handle.
+         *          Advances the asynchronous present or the job queue.
+         */
+        void onDma2dTransferComplete();
+
+        /**
+         * @brief Notify the driver that a DMA2D transfer failed.
+         * @details Call from the `XferErrorCallback` of the DMA2D handle. The
+         *          failed job counts as done so waits end, and the next one starts.
+         */
+        void onDma2dTransferError();
+    };
+
+    /**
+     * @brief Scoped frame transaction: `beginFrame` on construction, `endFrame` on destruction.
+     *
+     * @code
+     * {
+     *     TFT_LCD::FrameGuard frame(lcd);
+     *     lcd.drawRectangle(0, 0, 240, 24, background);
+     *     lcd.putText("Status", 4, 4, Font16, foreground);
+     * }   // one present here
+     * @endcode
+     */
+    class FrameGuard{
+    private:
+        ILI9341& _display;
+
+    public:
+        /**
+         * @brief Open a frame transaction.
+         * @param display Display to compose a frame on.
+         */
+        explicit FrameGuard(ILI9341& display)
+            : _display{display}
+        {
+            _display.beginFrame();
+        }
+
+        /** @brief Close the transaction and present the frame. */
+        ~FrameGuard(){
+            _display.endFrame();
+        }
+
+        FrameGuard(const FrameGuard&) = delete;
+        FrameGuard& operator=(const FrameGuard&) = delete;
     };
 }
 
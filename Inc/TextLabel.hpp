@@ -0,0 +1,145 @@
+#ifdef __cplusplus
+
+#ifndef __TEXT_LABEL_LIB_H__
+#define __TEXT_LABEL_LIB_H__
+
+/**
+ * @file TextLabel.hpp
+ * @brief Opaque single-line text label that repaints only changed cells.
+ */
+
+#include <cstdint>
+#include <string_view>
+#include "FrameBuffer.hpp"
+#include "font/fonts.hpp"
+
+namespace TFT_LCD {
+    /**
+     * @brief Remembers what it last drew and repaints only the cells that differ.
+     *
+     * @details
+     * The label owns a line of monospace `sFONT` cells at a fixed position.
+     * `update` compares the new text with the last rendered text character by
+     * character and draws only the differing cells, opaque, so no separate
+     * clear is needed. Cells left over from a longer previous text are
+     * painted with the background. Adjacent changed cells are merged into one
+     * rectangle; the rectangles of the last update can be read back, e.g. to
+     * mark them dirty. Changing position, font or colors repaints everything.
+     * Characters outside printable ASCII are drawn as blank cells.
+     */
+    class TextLabel{
+    public:
+        /** @brief Maximum number of characters kept by a label. */
+        static const uint32_t MAX_LENGTH {32};
+        /** @brief Maximum number of changed rectangles reported per update. */
+        static const uint32_t MAX_CHANGED_RECTS {8};
+
+    private:
+        uint32_t _x;
+        uint32_t _y;
+        const sFONT* _font;
+        Pixel _color;
+        Pixel _background;
+
+        uint8_t _text[MAX_LENGTH];
+        uint32_t _length = 0;
+        bool _isValid = false;
+        bool _isMoved = false;
+
+        /** @brief Area covered by the last rendered text, cleared when the label moves. */
+        Rect _paintedArea {0, 0, 0, 0};
+
+        Rect _changedRects[MAX_CHANGED_RECTS];
+        uint32_t _changedCount = 0;
+
+        /**
+         * @brief Append a changed cell run, merging into the last rectangle if adjacent.
+         * @param first First changed cell index.
+         * @param count Number of changed cells.
+         */
+        void addChangedCells(uint32_t first, uint32_t count);
+
+        /**
+         * @brief Append a changed rectangle, growing the last one when the list is full.
+         * @param rect Changed area.
+         */
+        void addChangedRect(const Rect& rect);
+
+    public:
+        /**
+         * @brief Construct an empty label.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         * @param font Monospace font descriptor.
+         * @param color Glyph color.
+         * @param background Cell background color.
+         */
+        TextLabel(uint32_t x, uint32_t y, const sFONT& font, Pixel color, Pixel background);
+
+        /**
+         * @brief Draw new text, repainting only the cells that changed.
+         * @param target Destination frame buffer.
+         * @param text UTF-8 text; characters past `MAX_LENGTH` are dropped.
+         * @return Number of changed rectangles, see `getChangedRect`.
+         */
+        uint32_t update(FrameBuffer& target, std::string_view text);
+
+        /**
+         * @brief Move the label; the next update clears the old area and repaints.
+         * @param x Left pixel coordinate.
+         * @param y Top pixel coordinate.
+         */
+        void setPosition(uint32_t x, uint32_t y);
+
+        /**
+         * @brief Change the font; the next update clears the old area and repaints.
+         * @param font Monospace font descriptor.
+         */
+        void setFont(const sFONT& font);
+
+        /**
+         * @brief Change the colors; the next update repaints every cell.
+         * @param color Glyph color.
+         * @param background Cell background color.
+         */
+        void setColors(Pixel color, Pixel background);
+
+        /** @brief Forget the rendered text so the next update repaints every cell. */
+        void invalidate();
+
+        /**
+         * @brief Get number of rectangles changed by the last update.
+         * @return Changed rectangle count.
+         */
+        uint32_t getChangedCount() const {
+            return _changedCount;
+        }
+
+        /**
+         * @brief Get one rectangle changed by the last update.
+         * @param index Rectangle index, less than `getChangedCount()`.
+         * @return Changed area in pixels.
+         */
+        const Rect& getChangedRect(uint32_t index) const {
+            return _changedRects[index];
+        }
+
+        /**
+         * @brief Get the largest area the next update can touch.
+         * @return Union of the painted area and a full-length label at the current position.
+         */
+        Rect getUpdateArea() const;
+
+        /**
+         * @brief Get the area covered by the label's current cells.
+         * @return Label extent in pixels.
+         */
+        Rect getBounds() const {
+            return Rect{_x, _y, _length * _font->Width, _font->Height};
+        }
+    };
+}
+
+#endif // __TEXT_LABEL_LIB_H__
+
+#endif // __cplusplus
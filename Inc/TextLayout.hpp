@@ -0,0 +1,125 @@
+#ifdef __cplusplus
+
+#ifndef __TEXT_LAYOUT_LIB_H__
+#define __TEXT_LAYOUT_LIB_H__
+
+/**
+ * @file TextLayout.hpp
+ * @brief Word-wrapped, aligned text layout for `sFONT` fonts.
+ */
+
+#include <cstdint>
+#include <string_view>
+#include "FrameBuffer.hpp"
+#include "font/fonts.hpp"
+
+namespace TFT_LCD {
+    /**
+     * @brief Breaks text into positioned lines inside a box.
+     *
+     * @details
+     * Lines are broken at spaces, or inside a word when it is wider than the
+     * box, and at explicit `'\n'`. The result is a fixed array of runs that
+     * reference the source text, so a layout can be kept and redrawn without
+     * recomputing; the text must outlive the layout. No heap is used.
+     */
+    class TextLayout{
+    public:
+        /** @brief Horizontal alignment of each line inside the box. */
+        enum Alignment : uint8_t{
+            LEFT    = 0,
+            CENTER  = 1,
+            RIGHT   = 2
+        };
+
+        /** @brief Maximum number of lines in one layout. */
+        static const uint32_t MAX_RUNS {16};
+
+        /**
+         * @brief One positioned line of text.
+         */
+        struct Run{
+            /** @brief Byte offset of the line in the source text. */
+            uint16_t offset;
+            /** @brief Line length in bytes. */
+            uint16_t length;
+            /** @brief Left pixel coordinate. */
+            uint16_t x;
+            /** @brief Top pixel coordinate. */
+            uint16_t y;
+            /** @brief Line width in pixels. */
+            uint16_t width;
+        };
+
+    private:
+        std::string_view _text;
+        const sFONT* _font = nullptr;
+        Run _runs[MAX_RUNS];
+        uint32_t _runCount = 0;
+        bool _isTruncated = false;
+
+    public:
+        TextLayout() = default;
+
+        /**
+         * @brief Lay out text inside a box.
+         * @param text UTF-8 text; must outlive the layout.
+         * @param font Font descriptor.
+         * @param box Bounding box; lines that do not fit vertically are dropped.
+         * @param alignment Horizontal alignment of each line.
+         * @return Number of runs produced.
+         */
+        uint32_t layout(std::string_view text, const sFONT& font, Rect box, Alignment alignment = LEFT);
+
+        /**
+         * @brief Draw all runs with `FrameBuffer::putText`.
+         * @param target Destination frame buffer.
+         * @param color Glyph color.
+         */
+        void draw(FrameBuffer& target, Pixel color) const;
+
+        /**
+         * @brief Get number of laid out lines.
+         * @return Run count.
+         */
+        uint32_t getRunCount() const {
+            return _runCount;
+        }
+
+        /**
+         * @brief Get one laid out line.
+         * @param index Run index, less than `getRunCount()`.
+         * @return Run descriptor.
+         */
+        const Run& getRun(uint32_t index) const {
+            return _runs[index];
+        }
+
+        /**
+         * @brief Get the text of one laid out line.
+         * @param index Run index, less than `getRunCount()`.
+         * @return Line text without trailing spaces.
+         */
+        std::string_view getRunText(uint32_t index) const {
+            return _text.substr(_runs[index].offset, _runs[index].length);
+        }
+
+        /**
+         * @brief Get the bounding box of all laid out lines.
+         * @return Union of the run rectangles; empty when there are no runs.
+         */
+        Rect getBounds() const;
+
+        /**
+         * @brief Check whether text was left over after the last line.
+         * @return `true` when the box or `MAX_RUNS` was too small.
+         */
+        bool isTruncated() const {
+            return _isTruncated;
+        }
+    };
+}
+
+#endif // __TEXT_LAYOUT_LIB_H__
+
+#endif // __cplusplus
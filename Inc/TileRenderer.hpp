@@ -0,0 +1,164 @@
+#ifdef __cplusplus
+
+#ifndef __TILE_RENDERER_LIB_H__
+#define __TILE_RENDERER_LIB_H__
+
+/**
+ * @file TileRenderer.hpp
+ * @brief Renders display lists tile by tile in a small fast-memory buffer.
+ */
+
+#include <cstdint>
+#include "DisplayList.hpp"
+#include "FrameBuffer.hpp"
+#include "main.h"
+
+namespace TFT_LCD {
+    /**
+     * @brief Composites display-list commands per screen tile before writing the frame buffer.
+     *
+     * @details
+     * The screen is split into tiles. For each tile the commands touching it
+     * are selected (binned), drawn into the tile buffer, and the finished tile
+     * is written to the frame buffer once, with DMA2D when a handle is given.
+     * Overlapping draws therefore hit the tile buffer, not SDRAM. A tile that
+     * is completely covered by a fill starts from the last such fill; other
+     * tiles are first loaded from the frame buffer. Tiles no command touches
+     * are skipped.
+     *
+     * Glyph cells crossing the tile edge are clipped row by row, so the
+     * tile buffer is exactly one tile and any cell size works. Place the
+     * buffer in internal SRAM reachable by DMA2D (not CCM).
+     */
+    class TileRenderer{
+    public:
+        /**
+         * @brief Memory traffic counters, in pixels.
+         */
+        struct Statistics{
+            /** @brief Tiles written to the frame buffer. */
+            uint32_t flushedTiles;
+            /** @brief Tiles that had to be read from the frame buffer first. */
+            uint32_t loadedTiles;
+            /** @brief Pixels inside command rectangles; what drawing directly would write at most. */
+            uint32_t commandPixels;
+            /** @brief Pixels written to the frame buffer by tile flushes. */
+            uint32_t flushedPixels;
+            /** @brief Pixels read from the frame buffer by tile loads. */
+            uint32_t loadedPixels;
+        };
+
+    private:
+        Pixel* const _arena;
+        uint32_t _tileWidth;
+        uint32_t _tileHeight;
+        FrameBuffer _tile;
+        DMA2D_HandleTypeDef* const _hdma2d;
+        Statistics _statistics {};
+
+        /**
+         * @brief Copy between the tile interior and the frame buffer.
+         * @param target Frame buffer.
+         * @param area Tile area in frame-buffer coordinates.
+         * @param isFlush `true` to write the tile out, `false` to load it.
+         */
+        void transfer(FrameBuffer& target, const Rect& area, bool isFlush);
+
+        /**
+         * @brief Draw one command into the tile buffer, clipped to the tile.
+         * @param list List that owns the command.
+         * @param command Command to draw.
+         * @param area Tile area in frame-buffer coordinates.
+         */
+        void drawCommand(const DisplayList& list, const DisplayList::Command& command, const Rect& area);
+
+        /**
+         * @brief Draw the set bits of one `sFONT` glyph, clipped to the tile.
+         * @param character ASCII character code.
+         * @param x Left frame-buffer coordinate of the cell.
+         * @param y Top frame-buffer coordinate of the cell.
+         * @param area Tile area in frame-buffer coordinates.
+         */
+        void drawGlyph(uint8_t character, uint32_t x, uint32_t y, const sFONT& font, Pixel color, const Rect& area);
+
+        /**
+         * @brief Draw one compact glyph, clipped to the tile.
+         * @param codepoint Unicode code point.
+         * @param x Left frame-buffer coordinate of the cell.
+         * @param y Top frame-buffer coordinate of the cell.
+         * @param area Tile area in frame-buffer coordinates.
+         */
+        void drawGlyph(uint32_t codepoint, uint32_t x, uint32_t y, const CompactFont& font, Pixel color, const Rect& area);
+
+        /**
+         * @brief Paint the set bits of a glyph row mask, dropping columns outside the tile.
+         * @param row Tile row; rows outside the tile are ignored.
+         * @param left Tile column of mask bit 31; may be negative.
+         * @param mask Row mask, most significant bit first.
+         * @param area Tile area in frame-buffer coordinates.
+         */
+        void fillClippedRow(int32_t row, int32_t left, uint32_t mask, Pixel color, const Rect& area);
+
+    public:
+        /**
+         * @brief Get the tile buffer size needed for a tile size.
+         * @param tileWidth Tile width in pixels.
+         * @param tileHeight Tile height in pixels.
+         * @return Buffer size in pixels.
+         */
+        static constexpr uint32_t getArenaPixels(uint32_t tileWidth, uint32_t tileHeight){
+            return tileWidth * tileHeight;
+        }
+
+        /**
+         * @brief Construct renderer over a caller-provided tile buffer.
+         * @details When the buffer is smaller than `getArenaPixels`, the tile
+         *          height is reduced to fit.
+         * @param arena RGB565 tile buffer, preferably internal SRAM.
+         * @param arenaPixels Buffer size in pixels.
+         * @param tileWidth Tile width in pixels.
+         * @param tileHeight Tile height in pixels.
+         * @param hdma2d Optional DMA2D handle used for tile loads and flushes.
+         */
+        TileRenderer(uint16_t* arena, uint32_t arenaPixels, uint32_t tileWidth, uint32_t tileHeight, DMA2D_HandleTypeDef* hdma2d = nullptr);
+
+        /**
+         * @brief Render a display list into a frame buffer.
+         * @param list Commands to draw.
+         * @param target Destination frame buffer.
+         * @return Bounding box of the tiles written.
+         */
+        Rect render(const DisplayList& list, FrameBuffer& target);
+
+        /**
+         * @brief Get the tile width.
+         * @return Tile width in pixels.
+         */
+        uint32_t getTileWidth() const {
+            return _tileWidth;
+        }
+
+        /**
+         * @brief Get the tile height.
+         * @return Tile height in pixels, possibly reduced to fit the buffer.
+         */
+        uint32_t getTileHeight() const {
+            return _tileHeight;
+        }
+
+        /**
+         * @brief Get memory traffic counters.
+         * @return Statistics since construction or the last reset.
+         */
+        const Statistics& getStatistics() const {
+            return _statistics;
+        }
+
+        /** @brief Reset memory traffic counters. */
+        void resetStatistics();
+    };
+}
+
+#endif // __TILE_RENDERER_LIB_H__
+
+#endif // __cplusplus
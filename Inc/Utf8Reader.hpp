@@ -0,0 +1,81 @@
+#ifdef __cplusplus
+
+#ifndef __UTF8_READER_LIB_H__
+#define __UTF8_READER_LIB_H__
+
+/**
+ * @file Utf8Reader.hpp
+ * @brief Sequential UTF-8 decoder used by the text rendering paths.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace TFT_LCD {
+    /**
+     * @brief Decodes code points from a UTF-8 string one at a time.
+     *
+     * @details
+     * Malformed, overlong and surrogate sequences decode to
+     * `REPLACEMENT_CHARACTER` and consume a single byte, so the reader
+     * always makes progress.
+     */
+    class Utf8Reader{
+    public:
+        /** @brief Code point returned for malformed input (U+FFFD). */
+        static const uint32_t REPLACEMENT_CHARACTER {0xFFFD};
+
+    private:
+        std::string_view _text;
+        size_t _position = 0;
+
+        /**
+         * @brief Decode a multi-byte sequence at the current position.
+         * @return Decoded code point or `REPLACEMENT_CHARACTER`.
+         */
+        uint32_t nextMultiByte();
+
+    public:
+        /**
+         * @brief Construct reader over UTF-8 text.
+         * @param text Encoded text; must outlive the reader.
+         */
+        explicit Utf8Reader(std::string_view text) : _text{text} {}
+
+        /**
+         * @brief Check whether undecoded bytes remain.
+         * @return `true` while `next` can be called.
+         */
+        bool hasNext() const {
+            return _position < _text.size();
+        }
+
+        /**
+         * @brief Get byte offset of the next code point.
+         * @return Offset into the text in bytes.
+         */
+        size_t getPosition() const {
+            return _position;
+        }
+
+        /**
+         * @brief Decode the next code point.
+         * @return Decoded code point.
+         */
+        uint32_t next(){
+            const uint8_t lead = static_cast<uint8_t>(_text[_position]);
+
+            if(lead < 0x80){
+                _position++;
+                return lead;
+            }
+
+            return nextMultiByte();
+        }
+    };
+}
+
+#endif // __UTF8_READER_LIB_H__
+
+#endif // __cplusplus
@@ -0,0 +1,180 @@
+#ifdef __cplusplus
+
+#ifndef __VIRTUAL_CANVAS_LIB_H__
+#define __VIRTUAL_CANVAS_LIB_H__
+
+/**
+ * @file VirtualCanvas.hpp
+ * @brief Frame buffer larger than the screen, panned and scrolled by LTDC addressing.
+ */
+
+#include <cstdint>
+#include "FrameBuffer.hpp"
+#include "main.h"
+
+namespace TFT_LCD {
+    /**
+     * @brief Large frame buffer with a screen-sized view into it.
+     *
+     * @details
+     * The view is shown by pointing the LTDC layer at the first visible pixel
+     * and setting the line pitch to the canvas width (`ILI9341::showCanvas`),
+     * so panning and scrolling copy no pixels.
+     *
+     * `PLANAR` canvases hold the whole content; `panTo` moves the view.
+     *
+     * `VERTICAL_RING` canvases scroll without end. The buffer is a ring of
+     * `height - viewHeight` rows followed by a copy of its first `viewHeight`
+     * rows, so every view position is one contiguous block for LTDC. `scroll`
+     * returns the rows that came into view, in canvas coordinates; only those
+     * are drawn. They are copied into the ring's duplicate rows by `commit`,
+     * which `ILI9341::showCanvas` calls once the driver is done with DMA2D.
+     * A `scroll` that finds rows still pending copies them with the CPU.
+     * Drawing stays off screen while each scroll step plus `viewHeight` does
+     * not exceed the ring height.
+     */
+    class VirtualCanvas{
+    public:
+        /** @brief Arrangement of the canvas rows. */
+        enum Layout : uint8_t{
+            PLANAR          = 0,
+            VERTICAL_RING   = 1
+        };
+
+    private:
+        FrameBuffer _buffer;
+        const uint32_t _viewWidth;
+        const uint32_t _viewHeight;
+        const Layout _layout;
+        DMA2D_HandleTypeDef* const _hdma2d;
+        /** @brief Rows in one ring period; the full height for `PLANAR`. */
+        const uint32_t _ringHeight;
+
+        uint32_t _viewLeft = 0;
+        uint32_t _viewTop = 0;
+        /** @brief Lines scrolled since construction; negative when scrolled up. */
+        int32_t _scrollPosition = 0;
+
+        /** @brief Rows drawn since the last `commit`, not yet duplicated. */
+        uint32_t _pendingTop = 0;
+        uint32_t _pendingBottom = 0;
+
+        /**
+         * @brief Copy full-width canvas rows.
+         * @param source First source row.
+         * @param destination First destination row.
+         * @param rows Number of rows.
+         * @param hdma2d DMA2D handle, or null to copy with the CPU.
+         */
+        void copyRows(uint32_t source, uint32_t destination, uint32_t rows, DMA2D_HandleTypeDef* hdma2d);
+
+        /**
+         * @brief Duplicate the pending rows into the ring copy.
+         * @param hdma2d DMA2D handle, or null to copy with the CPU.
+         */
+        void commitRows(DMA2D_HandleTypeDef* hdma2d);
+
+    public:
+        /**
+         * @brief Construct canvas over a caller-provided buffer and clear it.
+         * @param buffer RGB565 canvas buffer, `width * height` pixels.
+         * @param width Canvas width in pixels; the LTDC line pitch.
+         * @param height Canvas height in pixels, including the ring duplicate rows.
+         * @param viewWidth Visible width in pixels.
+         * @param viewHeight Visible height in pixels.
+         * @param layout Row arrangement; `VERTICAL_RING` needs `height >= 2 * viewHeight`
+         *        and falls back to `PLANAR` otherwise.
+         * @param hdma2d Optional DMA2D handle used to duplicate ring rows.
+         */
+        VirtualCanvas(uint16_t* buffer, uint32_t width, uint32_t height, uint32_t viewWidth, uint32_t viewHeight, Layout layout = PLANAR, DMA2D_HandleTypeDef* hdma2d = nullptr);
+
+        /**
+         * @brief Get the canvas frame buffer for drawing.
+         * @return Frame buffer covering the whole canvas.
+         */
+        FrameBuffer& getFrameBuffer(){
+            return _buffer;
+        }
+
+        /**
+         * @brief Move the view to a canvas position.
+         * @details For `VERTICAL_RING` only the horizontal position is used;
+         *          rows are moved with `scroll`. Clamped to the canvas.
+         * @param left Left canvas column of the view.
+         * @param top Top canvas row of the view.
+         */
+        void panTo(uint32_t left, uint32_t top);
+
+        /**
+         * @brief Scroll a ring canvas vertically.
+         * @param lines Lines to advance; positive reveals rows at the bottom,
+         *        negative at the top.
+         * @return Canvas rows that came into view and must be drawn; empty
+         *         for `PLANAR` canvases or when `lines` is zero.
+         */
+        Rect scroll(int32_t lines);
+
+        /**
+         * @brief Duplicate the rows revealed by the last `scroll` into the ring copy.
+         * @details Called by `ILI9341::showCanvas`; only the revealed rows
+         *          that fall into the duplicated part of the ring are copied.
+         *          Uses the canvas DMA2D handle, so it must not run while an
+         *          asynchronous present or queued job uses the same handle.
+         */
+        void commit();
+
+        /**
+         * @brief Get the first visible pixel.
+         * @return Address LTDC scans out from.
+         */
+        const Pixel* getViewAddress() const {
+            return static_cast<const Pixel*>(_buffer.getBufferAddress()) + (_viewTop * _buffer.getWidth()) + _viewLeft;
+        }
+
+        /**
+         * @brief Get the canvas line pitch.
+         * @return Canvas width in pixels.
+         */
+        uint32_t getPitch() const {
+            return _buffer.getWidth();
+        }
+
+        /**
+         * @brief Get the left canvas column of the view.
+         * @return Column index.
+         */
+        uint32_t getViewLeft() const {
+            return _viewLeft;
+        }
+
+        /**
+         * @brief Get the top canvas row of the view.
+         * @return Row index.
+         */
+        uint32_t getViewTop() const {
+            return _viewTop;
+        }
+
+        /**
+         * @brief Get the total number of lines scrolled.
+         * @details Content line `n` of a ring canvas is shown at view row
+         *          `n - getScrollPosition()`.
+         * @return Sum of all `scroll` arguments.
+         */
+        int32_t getScrollPosition() const {
+            return _scrollPosition;
+        }
+
+        /**
+         * @brief Get the row arrangement.
+         * @return Canvas layout.
+         */
+        Layout getLayout() const {
+            return _layout;
+        }
+    };
+}
+
+#endif // __VIRTUAL_CANVAS_LIB_H__
+
+#endif // __cplusplus
@@ -0,0 +1,35 @@
+#ifdef __cplusplus
+
+#ifndef __ANTI_ALIASED_FONT_LIB_H__
+#define __ANTI_ALIASED_FONT_LIB_H__
+
+/**
+ * @file AntiAliasedFont.hpp
+ * @brief Anti-aliased font descriptor with 4-bit or 8-bit glyph coverage.
+ *
+ * @details
+ * Glyph placement, advances and kerning come from `layout`; its table holds
+ * coverage rows instead of 1-bpp bitmaps. With 4 bits per pixel a row is
+ * `(width + 1) / 2` bytes and the left pixel of each byte sits in bits [3:0],
+ * matching the DMA2D A4 input format. With 8 bits per pixel a row is
+ * `width` bytes (DMA2D A8).
+ */
+
+#include <cstdint>
+#include "font/ProportionalFont.hpp"
+
+namespace TFT_LCD {
+    /**
+     * @brief Anti-aliased font resource.
+     */
+    struct AntiAliasedFont {
+        /** @brief Glyph metrics, kerning and coverage table. */
+        ProportionalFont layout;
+        /** @brief Coverage bits per pixel, either 4 or 8. */
+        uint8_t bitsPerPixel;
+    };
+}
+
+#endif // __ANTI_ALIASED_FONT_LIB_H__
+
+#endif // __cplusplus
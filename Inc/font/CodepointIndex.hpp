@@ -0,0 +1,53 @@
+#ifdef __cplusplus
+
+#ifndef __CODEPOINT_INDEX_LIB_H__
+#define __CODEPOINT_INDEX_LIB_H__
+
+/**
+ * @file CodepointIndex.hpp
+ * @brief Sparse code point to glyph index mapping for extended fonts.
+ *
+ * @details
+ * The index is a table of non-overlapping runs of consecutive code points.
+ * Range 0 may be any run: it is tested first in constant time, so fonts put
+ * their densest run (usually printable ASCII, the largest run in fontc
+ * output) there. Ranges 1 to `rangeCount - 1` must be sorted by first code
+ * point; any other code point is found by binary search over them.
+ */
+
+#include <cstdint>
+
+namespace TFT_LCD {
+    /**
+     * @brief Run of consecutive code points mapped to consecutive glyphs.
+     */
+    struct CodepointRange {
+        /** @brief First code point of the run. */
+        uint32_t first;
+        /** @brief Number of code points in the run. */
+        uint16_t count;
+        /** @brief Glyph index of `first`. */
+        uint16_t glyphIndex;
+    };
+
+    /**
+     * @brief Range table mapping code points to glyph indices.
+     */
+    struct CodepointIndex {
+        /** @brief Non-overlapping ranges; range 0 is any run, the rest are sorted by `first`. */
+        const CodepointRange* ranges;
+        /** @brief Number of entries in `ranges`. */
+        uint16_t rangeCount;
+
+        /**
+         * @brief Find the glyph index of a code point.
+         * @param codepoint Unicode code point.
+         * @return Glyph index, or `-1` when the code point is not covered.
+         */
+        int32_t find(uint32_t codepoint) const;
+    };
+}
+
+#endif // __CODEPOINT_INDEX_LIB_H__
+
+#endif // __cplusplus
@@ -0,0 +1,61 @@
+#ifdef __cplusplus
+
+#ifndef __COMPACT_FONT_LIB_H__
+#define __COMPACT_FONT_LIB_H__
+
+/**
+ * @file CompactFont.hpp
+ * @brief Monospace 1-bpp font stored as bit-packed glyph bounding boxes.
+ *
+ * @details
+ * Only the tight bounding box of each glyph is stored. Its `width * height`
+ * bits follow each other without row padding, most significant bit first,
+ * starting at byte `CompactGlyph::offset` of the data table. Blank glyphs
+ * have a zero-sized box. Boxes are at most 24 pixels wide so a row always
+ * fits the renderer's 32-bit bit reader.
+ */
+
+#include <cstdint>
+#include "font/CodepointIndex.hpp"
+
+namespace TFT_LCD {
+    /**
+     * @brief Bounding box and data offset of one compact glyph.
+     */
+    struct CompactGlyph {
+        /** @brief Byte offset of the glyph bits in the data table. */
+        uint16_t offset;
+        /** @brief Left edge of the box inside the cell, in pixels. */
+        uint8_t x;
+        /** @brief Top edge of the box inside the cell, in pixels. */
+        uint8_t y;
+        /** @brief Box width in pixels (0..24). */
+        uint8_t width;
+        /** @brief Box height in pixels. */
+        uint8_t height;
+    };
+
+    /**
+     * @brief Compact monospace font resource.
+     */
+    struct CompactFont {
+        /** @brief Bit-packed glyph boxes. */
+        const uint8_t* data;
+        /** @brief Glyph boxes, indexed by glyph index. */
+        const CompactGlyph* glyphs;
+        /** @brief Code point to glyph index mapping. */
+        CodepointIndex index;
+        /** @brief Cell width (pen advance) in pixels. */
+        uint16_t cellWidth;
+        /** @brief Cell height in pixels. */
+        uint16_t cellHeight;
+    };
+
+    extern const CompactFont Font24Compact;
+    extern const CompactFont Font20Compact;
+    extern const CompactFont Font16Compact;
+}
+
+#endif // __COMPACT_FONT_LIB_H__
+
+#endif // __cplusplus
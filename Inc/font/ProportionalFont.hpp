@@ -0,0 +1,82 @@
+#ifdef __cplusplus
+
+#ifndef __PROPORTIONAL_FONT_LIB_H__
+#define __PROPORTIONAL_FONT_LIB_H__
+
+/**
+ * @file ProportionalFont.hpp
+ * @brief Proportional (variable advance) 1-bpp font descriptor.
+ *
+ * @details
+ * Each glyph bitmap is stored as `height` rows of `(width + 7) / 8` bytes,
+ * most significant bit first, starting at `GlyphMetrics::offset` in the
+ * font table. Glyph bitmaps are at most 32 pixels wide.
+ */
+
+#include <cstdint>
+#include "font/CodepointIndex.hpp"
+
+namespace TFT_LCD {
+    /**
+     * @brief Placement and size of one glyph inside a proportional font.
+     */
+    struct GlyphMetrics {
+        /** @brief Byte offset of the first bitmap row in the font table. */
+        uint32_t offset;
+        /** @brief Bitmap width in pixels (1..32, 0 for blank glyphs). */
+        uint8_t width;
+        /** @brief Horizontal pen advance in pixels. */
+        uint8_t advance;
+        /** @brief Left side bearing from pen position to bitmap, in pixels. */
+        int8_t bearingX;
+    };
+
+    /**
+     * @brief Kerning adjustment applied between two consecutive glyphs.
+     */
+    struct KerningPair {
+        /** @brief Glyph index of the left glyph. */
+        uint16_t left;
+        /** @brief Glyph index of the right glyph. */
+        uint16_t right;
+        /** @brief Pen adjustment in pixels added before the right glyph. */
+        int8_t adjust;
+    };
+
+    /**
+     * @brief Proportional 1-bpp font resource.
+     */
+    struct ProportionalFont {
+        /** @brief Packed glyph bitmaps. */
+        const uint8_t* table;
+        /** @brief Glyph metrics, indexed by glyph index. */
+        const GlyphMetrics* glyphs;
+        /** @brief Code point to glyph index mapping. */
+        CodepointIndex index;
+        /** @brief Kerning pairs sorted by `(left, right)`; may be null. */
+        const KerningPair* kerningPairs;
+        /** @brief Number of entries in `kerningPairs`. */
+        uint16_t kerningPairCount;
+        /** @brief Glyph cell height in pixels. */
+        uint16_t height;
+
+        /**
+         * @brief Find the glyph index of a code point.
+         * @param codepoint Unicode code point.
+         * @return Glyph index, or `-1` when the font has no such glyph.
+         */
+        int32_t getGlyphIndex(uint32_t codepoint) const;
+
+        /**
+         * @brief Look up the kerning adjustment of a glyph pair.
+         * @param left Glyph index of the left glyph.
+         * @param right Glyph index of the right glyph.
+         * @return Pen adjustment in pixels, `0` when the pair is not kerned.
+         */
+        int32_t getKerning(uint16_t left, uint16_t right) const;
+    };
+}
+
+#endif // __PROPORTIONAL_FONT_LIB_H__
+
+#endif // __cplusplus
@@ -0,0 +1,133 @@
+#include "DamageList.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace TFT_LCD {
+    namespace {
+        /** @brief Area of a rectangle in pixels. */
+        inline uint32_t area(const Rect& rect){
+            return rect.width * rect.height;
+        }
+
+        /** @brief Check whether two rectangles share at least one pixel. */
+        inline bool overlaps(const Rect& a, const Rect& b){
+            return a.x < b.x + b.width && b.x < a.x + a.width
+                && a.y < b.y + b.height && b.y < a.y + a.height;
+        }
+
+        /** @brief Check whether two rectangles share a full edge, so their union is exact. */
+        inline bool sharesEdge(const Rect& a, const Rect& b){
+            const bool isRow = (a.y == b.y && a.height == b.height)
+                && (a.x + a.width == b.x || b.x + b.width == a.x);
+            const bool isColumn = (a.x == b.x && a.width == b.width)
+                && (a.y + a.height == b.y || b.y + b.height == a.y);
+
+            return isRow || isColumn;
+        }
+    }
+
+    DamageList::DamageList(uint32_t frameWidth, uint32_t frameHeight)
+        : _frameWidth{frameWidth}, _frameHeight{frameHeight}
+    {
+    }
+
+    void DamageList::unite(Rect& target, const Rect& other){
+        const uint32_t right = std::max(target.x + target.width, other.x + other.width);
+        const uint32_t bottom = std::max(target.y + target.height, other.y + other.height);
+
+        target.x = std::min(target.x, other.x);
+        target.y = std::min(target.y, other.y);
+        target.width = right - target.x;
+        target.height = bottom - target.y;
+    }
+
+    void DamageList::absorbOverlaps(uint32_t index){
+        bool isGrown = true;
+
+        while(isGrown == true){
+            isGrown = false;
+
+            for(uint32_t idx = 0; idx < _count; idx++){
+                if(idx == index || overlaps(_rects[idx], _rects[index]) == false){
+                    continue;
+                }
+
+                unite(_rects[index], _rects[idx]);
+
+                // Fill the hole with the last entry, keeping `index` valid.
+                _count--;
+                if(index == _count){
+                    index = idx;
+                }
+                _rects[idx] = _rects[_count];
+
+                isGrown = true;
+                break;
+            }
+        }
+    }
+
+    void DamageList::add(Rect rect){
+        if(rect.x >= _frameWidth || rect.y >= _frameHeight){
+            return;
+        }
+
+        rect.width = std::min(rect.width, _frameWidth - rect.x);
+        rect.height = std::min(rect.height, _frameHeight - rect.y);
+
+        if(rect.width == 0 || rect.height == 0){
+            return;
+        }
+
+        for(uint32_t idx = 0; idx < _count; idx++){
+            if(overlaps(_rects[idx], rect) == true || sharesEdge(_rects[idx], rect) == true){
+                unite(_rects[idx], rect);
+                absorbOverlaps(idx);
+                return;
+            }
+        }
+
+        if(_count < MAX_RECTS){
+            _rects[_count++] = rect;
+            return;
+        }
+
+        uint32_t best = 0;
+        uint32_t bestGrowth = UINT32_MAX;
+
+        for(uint32_t idx = 0; idx < _count; idx++){
+            Rect merged = _rects[idx];
+            unite(merged, rect);
+
+            const uint32_t growth = area(merged) - area(_rects[idx]);
+
+            if(growth < bestGrowth){
+                best = idx;
+                bestGrowth = growth;
+            }
+        }
+
+        unite(_rects[best], rect);
+        absorbOverlaps(best);
+    }
+
+    void DamageList::addAll(){
+        _rects[0] = Rect{0, 0, _frameWidth, _frameHeight};
+        _count = 1;
+    }
+
+    void DamageList::clear(){
+        _count = 0;
+    }
+
+    uint32_t DamageList::getPixelCount() const {
+        uint32_t pixels = 0;
+
+        for(uint32_t idx = 0; idx < _count; idx++){
+            pixels += area(_rects[idx]);
+        }
+
+        return pixels;
+    }
+}
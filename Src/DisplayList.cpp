@@ -0,0 +1,230 @@
+#include "DisplayList.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+namespace TFT_LCD {
+    namespace {
+        /** @brief Check whether two commands share at least one pixel. */
+        inline bool overlaps(const DisplayList::Command& a, const DisplayList::Command& b){
+            return a.x < b.x + b.width && b.x < a.x + a.width
+                && a.y < b.y + b.height && b.y < a.y + a.height;
+        }
+
+        /** @brief Check whether `outer` covers every pixel of `inner`. */
+        inline bool contains(const DisplayList::Command& outer, const DisplayList::Command& inner){
+            return outer.x <= inner.x && inner.x + inner.width <= outer.x + outer.width
+                && outer.y <= inner.y && inner.y + inner.height <= outer.y + outer.height;
+        }
+
+        /**
+         * @brief Merge `b` into `a` when both are same-colour fills sharing a full edge.
+         * @return `true` when merged.
+         */
+        bool mergeEdge(DisplayList::Command& a, const DisplayList::Command& b){
+            if(a.kind != DisplayList::FILL_RECT || b.kind != DisplayList::FILL_RECT || a.color.value != b.color.value){
+                return false;
+            }
+
+            if(a.y == b.y && a.height == b.height && (a.x + a.width == b.x || b.x + b.width == a.x)){
+                a.x = (a.x < b.x) ? a.x : b.x;
+                a.width += b.width;
+                return true;
+            }
+
+            if(a.x == b.x && a.width == b.width && (a.y + a.height == b.y || b.y + b.height == a.y)){
+                a.y = (a.y < b.y) ? a.y : b.y;
+                a.height += b.height;
+                return true;
+            }
+
+            return false;
+        }
+    }
+
+    bool DisplayList::append(const Command& command){
+        if(_count == MAX_COMMANDS){
+            _isOverflowed = true;
+            return false;
+        }
+
+        _commands[_count++] = command;
+        return true;
+    }
+
+    bool DisplayList::storeText(std::string_view text, uint16_t& offset){
+        if(text.size() > TEXT_POOL_SIZE - _textUsed){
+            _isOverflowed = true;
+            return false;
+        }
+
+        memcpy(&_textPool[_textUsed], text.data(), text.size());
+        offset = static_cast<uint16_t>(_textUsed);
+        _textUsed += text.size();
+
+        return true;
+    }
+
+    bool DisplayList::drawRectangle(uint32_t x, uint32_t y, uint32_t width, uint32_t height, Pixel color){
+        if(width == 0 || height == 0){
+            return true;
+        }
+
+        return append(Command{
+            static_cast<uint16_t>(x), static_cast<uint16_t>(y),
+            static_cast<uint16_t>(width), static_cast<uint16_t>(height),
+            nullptr, 0, 0, color, FILL_RECT
+        });
+    }
+
+    bool DisplayList::putText(std::string_view text, uint32_t x, uint32_t y, const sFONT& font, Pixel color){
+        uint16_t offset = 0;
+
+        if(_count == MAX_COMMANDS){
+            _isOverflowed = true;
+            return false;
+        }
+
+        if(storeText(text, offset) == false){
+            return false;
+        }
+
+        return append(Command{
+            static_cast<uint16_t>(x), static_cast<uint16_t>(y),
+            static_cast<uint16_t>(FrameBuffer::measureText(text, font)), font.Height,
+            &font, offset, static_cast<uint16_t>(text.size()), color, TEXT_SFONT
+        });
+    }
+
+    bool DisplayList::putText(std::string_view text, uint32_t x, uint32_t y, const CompactFont& font, Pixel color){
+        uint16_t offset = 0;
+
+        if(_count == MAX_COMMANDS){
+            _isOverflowed = true;
+            return false;
+        }
+
+        if(storeText(text, offset) == false){
+            return false;
+        }
+
+        return append(Command{
+            static_cast<uint16_t>(x), static_cast<uint16_t>(y),
+            static_cast<uint16_t>(FrameBuffer::measureText(text, font)), font.cellHeight,
+            &font, offset, static_cast<uint16_t>(text.size()), color, TEXT_COMPACT
+        });
+    }
+
+    void DisplayList::compact(){
+        uint32_t kept = 0;
+
+        for(uint32_t idx = 0; idx < _count; idx++){
+            if(_commands[idx].width != 0){
+                _commands[kept++] = _commands[idx];
+            }
+        }
+
+        _count = kept;
+    }
+
+    uint32_t DisplayList::removeOccluded(){
+        uint32_t removed = 0;
+
+        for(uint32_t idx = 0; idx < _count; idx++){
+            for(uint32_t later = idx + 1; later < _count; later++){
+                if(_commands[later].kind == FILL_RECT && contains(_commands[later], _commands[idx]) == true){
+                    _commands[idx].width = 0;
+                    removed++;
+                    break;
+                }
+            }
+        }
+
+        compact();
+        return removed;
+    }
+
+    uint32_t DisplayList::mergeFills(){
+        uint32_t merged = 0;
+
+        for(uint32_t idx = 0; idx < _count; idx++){
+            if(_commands[idx].width == 0){
+                continue;
+            }
+
+            for(uint32_t later = idx + 1; later < _count; later++){
+                Command& first = _commands[idx];
+                const Command& second = _commands[later];
+
+                if(second.width == 0){
+                    continue;
+                }
+
+                // Merging moves `second` earlier: only allowed when nothing in
+                // between touches either rectangle.
+                bool isBlocked = false;
+
+                for(uint32_t between = idx + 1; between < later && isBlocked == false; between++){
+                    const Command& other = _commands[between];
+                    isBlocked = other.width != 0 && (overlaps(other, first) == true || overlaps(other, second) == true);
+                }
+
+                if(isBlocked == false && mergeEdge(first, second) == true){
+                    _commands[later].width = 0;
+                    merged++;
+                    later = idx;    // the grown rectangle may now meet earlier candidates
+                }
+            }
+        }
+
+        compact();
+        return merged;
+    }
+
+    void DisplayList::sortByRow(){
+        // Insertion sort that only swaps neighbours that do not overlap, so
+        // the drawing order of overlapping commands is kept.
+        for(uint32_t idx = 1; idx < _count; idx++){
+            for(uint32_t pos = idx; pos > 0; pos--){
+                Command& previous = _commands[pos - 1];
+                Command& current = _commands[pos];
+
+                if(previous.y <= current.y || overlaps(previous, current) == true){
+                    break;
+                }
+
+                const Command swapped = previous;
+                previous = current;
+                current = swapped;
+            }
+        }
+    }
+
+    uint32_t DisplayList::optimize(){
+        const uint32_t before = _count;
+
+        removeOccluded();
+        mergeFills();
+        sortByRow();
+
+        return before - _count;
+    }
+
+    void DisplayList::clear(){
+        _count = 0;
+        _textUsed = 0;
+        _isOverflowed = false;
+    }
+
+    uint32_t DisplayList::getFillPixelCount() const {
+        uint32_t pixels = 0;
+
+        for(uint32_t idx = 0; idx < _count; idx++){
+            if(_commands[idx].kind == FILL_RECT){
+                pixels += _commands[idx].width * _commands[idx].height;
+            }
+        }
+
+        return pixels;
+    }
+}
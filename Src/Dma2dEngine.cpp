@@ -0,0 +1,197 @@
+#include "Dma2dEngine.hpp"
+#include "main.h"
+#include <cstdint>
+
+namespace TFT_LCD {
+    namespace {
+        /** @brief Expand RGB565 to the ARGB8888 register format, repeating the high bits. */
+        uint32_t toArgb8888(Pixel color){
+            const uint32_t red = (color.color.red << 3) | (color.color.red >> 2);
+            const uint32_t green = (color.color.green << 2) | (color.color.green >> 4);
+            const uint32_t blue = (color.color.blue << 3) | (color.color.blue >> 2);
+
+            return 0xFF000000 | (red << 16) | (green << 8) | blue;
+        }
+    }
+
+    Dma2dEngine::WaitHandler Dma2dEngine::_waitHandler = nullptr;
+    void* Dma2dEngine::_waitContext = nullptr;
+
+    Dma2dEngine::Dma2dEngine(DMA2D_HandleTypeDef* hdma2d)
+        : _hdma2d{hdma2d}
+    {
+    }
+
+    void Dma2dEngine::setWaitHandler(WaitHandler handler, void* context){
+        _waitHandler = handler;
+        _waitContext = context;
+    }
+
+    void Dma2dEngine::idle(){
+        if(_waitHandler != nullptr){
+            _waitHandler(_waitContext);
+        }
+    }
+
+    void Dma2dEngine::waitUntilIdle(){
+        // Queued jobs chain from the interrupt, so this can span the whole queue.
+        while(_hdma2d->State == HAL_DMA2D_STATE_BUSY){
+            idle();
+        }
+    }
+
+    void Dma2dEngine::setupTransfer(uint32_t mode, uint32_t inputColorMode, uint32_t sourcePitch, uint32_t destinationPitch, uint32_t width){
+        _hdma2d->Init.Mode = mode;
+        _hdma2d->Init.ColorMode = DMA2D_OUTPUT_RGB565;
+        _hdma2d->Init.OutputOffset = destinationPitch - width;
+
+        _hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].InputColorMode = inputColorMode;
+        _hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].InputOffset = sourcePitch - width;
+        _hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+        _hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].InputAlpha = 0xFF;
+
+        HAL_DMA2D_Init(_hdma2d);
+        HAL_DMA2D_ConfigLayer(_hdma2d, DMA2D_FOREGROUND_LAYER);
+    }
+
+    void Dma2dEngine::setupBlend(uint32_t foregroundPitch, uint32_t backgroundPitch, uint8_t alpha, uint32_t destinationPitch, uint32_t width){
+        _hdma2d->Init.Mode = DMA2D_M2M_BLEND;
+        _hdma2d->Init.ColorMode = DMA2D_OUTPUT_RGB565;
+        _hdma2d->Init.OutputOffset = destinationPitch - width;
+
+        // RGB565 has no alpha channel: the constant replaces it.
+        _hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].InputColorMode = DMA2D_INPUT_RGB565;
+        _hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].InputOffset = foregroundPitch - width;
+        _hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].AlphaMode = DMA2D_REPLACE_ALPHA;
+        _hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].InputAlpha = alpha;
+
+        _hdma2d->LayerCfg[DMA2D_BACKGROUND_LAYER].InputColorMode = DMA2D_INPUT_RGB565;
+        _hdma2d->LayerCfg[DMA2D_BACKGROUND_LAYER].InputOffset = backgroundPitch - width;
+        _hdma2d->LayerCfg[DMA2D_BACKGROUND_LAYER].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+        _hdma2d->LayerCfg[DMA2D_BACKGROUND_LAYER].InputAlpha = 0xFF;
+
+        HAL_DMA2D_Init(_hdma2d);
+        HAL_DMA2D_ConfigLayer(_hdma2d, DMA2D_FOREGROUND_LAYER);
+        HAL_DMA2D_ConfigLayer(_hdma2d, DMA2D_BACKGROUND_LAYER);
+    }
+
+    void Dma2dEngine::setupFill(uint32_t destinationPitch, uint32_t width){
+        _hdma2d->Init.Mode = DMA2D_R2M;
+        _hdma2d->Init.ColorMode = DMA2D_OUTPUT_RGB565;
+        _hdma2d->Init.OutputOffset = destinationPitch - width;
+
+        HAL_DMA2D_Init(_hdma2d);
+    }
+
+    void Dma2dEngine::copy(const Pixel* source, uint32_t sourcePitch, Pixel* destination, uint32_t destinationPitch, uint32_t width, uint32_t height){
+        waitUntilIdle();
+        setupTransfer(DMA2D_M2M, DMA2D_INPUT_RGB565, sourcePitch, destinationPitch, width);
+
+        HAL_DMA2D_Start(
+                _hdma2d,
+                reinterpret_cast<uint32_t>(source),
+                reinterpret_cast<uint32_t>(destination),
+                width,
+                height);
+
+        HAL_DMA2D_PollForTransfer(_hdma2d, HAL_MAX_DELAY);
+    }
+
+    bool Dma2dEngine::startCopy(const Pixel* source, uint32_t sourcePitch, Pixel* destination, uint32_t destinationPitch, uint32_t width, uint32_t height){
+        setupTransfer(DMA2D_M2M, DMA2D_INPUT_RGB565, sourcePitch, destinationPitch, width);
+
+        return HAL_DMA2D_Start_IT(
+                _hdma2d,
+                reinterpret_cast<uint32_t>(source),
+                reinterpret_cast<uint32_t>(destination),
+                width,
+                height) == HAL_OK;
+    }
+
+    void Dma2dEngine::blend(const uint8_t* alpha, AlphaFormat format, Pixel color, Pixel* destination, uint32_t destinationPitch, uint32_t width, uint32_t height){
+        waitUntilIdle();
+
+        _hdma2d->Init.Mode = DMA2D_M2M_BLEND;
+        _hdma2d->Init.ColorMode = DMA2D_OUTPUT_RGB565;
+        _hdma2d->Init.OutputOffset = destinationPitch - width;
+
+        _hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].InputColorMode = (format == A4) ? DMA2D_INPUT_A4 : DMA2D_INPUT_A8;
+        _hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].InputOffset = 0;
+        _hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+        // A4/A8 layers take their color from InputAlpha as ARGB8888.
+        _hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].InputAlpha = toArgb8888(color);
+
+        _hdma2d->LayerCfg[DMA2D_BACKGROUND_LAYER].InputColorMode = DMA2D_INPUT_RGB565;
+        _hdma2d->LayerCfg[DMA2D_BACKGROUND_LAYER].InputOffset = destinationPitch - width;
+        _hdma2d->LayerCfg[DMA2D_BACKGROUND_LAYER].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+        _hdma2d->LayerCfg[DMA2D_BACKGROUND_LAYER].InputAlpha = 0xFF;
+
+        HAL_DMA2D_Init(_hdma2d);
+        HAL_DMA2D_ConfigLayer(_hdma2d, DMA2D_FOREGROUND_LAYER);
+        HAL_DMA2D_ConfigLayer(_hdma2d, DMA2D_BACKGROUND_LAYER);
+
+        HAL_DMA2D_BlendingStart(
+                _hdma2d,
+                reinterpret_cast<uint32_t>(alpha),        // Foreground (coverage)
+                reinterpret_cast<uint32_t>(destination),  // Background
+                reinterpret_cast<uint32_t>(destination),  // Output
+                width,
+                height);
+
+        HAL_DMA2D_PollForTransfer(_hdma2d, HAL_MAX_DELAY);
+    }
+
+    void Dma2dEngine::blend(const Pixel* foreground, uint32_t foregroundPitch, const Pixel* background, uint32_t backgroundPitch, uint8_t alpha, Pixel* destination, uint32_t destinationPitch, uint32_t width, uint32_t height){
+        waitUntilIdle();
+        setupBlend(foregroundPitch, backgroundPitch, alpha, destinationPitch, width);
+
+        HAL_DMA2D_BlendingStart(
+                _hdma2d,
+                reinterpret_cast<uint32_t>(foreground),
+                reinterpret_cast<uint32_t>(background),
+                reinterpret_cast<uint32_t>(destination),
+                width,
+                height);
+
+        HAL_DMA2D_PollForTransfer(_hdma2d, HAL_MAX_DELAY);
+    }
+
+    bool Dma2dEngine::startBlend(const Pixel* foreground, uint32_t foregroundPitch, const Pixel* background, uint32_t backgroundPitch, uint8_t alpha, Pixel* destination, uint32_t destinationPitch, uint32_t width, uint32_t height){
+        setupBlend(foregroundPitch, backgroundPitch, alpha, destinationPitch, width);
+
+        return HAL_DMA2D_BlendingStart_IT(
+                _hdma2d,
+                reinterpret_cast<uint32_t>(foreground),
+                reinterpret_cast<uint32_t>(background),
+                reinterpret_cast<uint32_t>(destination),
+                width,
+                height) == HAL_OK;
+    }
+
+    void Dma2dEngine::fill(Pixel color, Pixel* destination, uint32_t destinationPitch, uint32_t width, uint32_t height){
+        waitUntilIdle();
+        setupFill(destinationPitch, width);
+
+        // In register-to-memory mode the source argument is the ARGB8888 color.
+        HAL_DMA2D_Start(_hdma2d, toArgb8888(color), reinterpret_cast<uint32_t>(destination), width, height);
+
+        HAL_DMA2D_PollForTransfer(_hdma2d, HAL_MAX_DELAY);
+    }
+
+    bool Dma2dEngine::startFill(Pixel color, Pixel* destination, uint32_t destinationPitch, uint32_t width, uint32_t height){
+        setupFill(destinationPitch, width);
+
+        return HAL_DMA2D_Start_IT(_hdma2d, toArgb8888(color), reinterpret_cast<uint32_t>(destination), width, height) == HAL_OK;
+    }
+
+    bool Dma2dEngine::startConvert(const void* source, uint32_t sourcePitch, uint32_t inputColorMode, Pixel* destination, uint32_t destinationPitch, uint32_t width, uint32_t height){
+        setupTransfer(DMA2D_M2M_PFC, inputColorMode, sourcePitch, destinationPitch, width);
+
+        return HAL_DMA2D_Start_IT(
+                _hdma2d,
+                reinterpret_cast<uint32_t>(source),
+                reinterpret_cast<uint32_t>(destination),
+                width,
+                height) == HAL_OK;
+    }
+}
@@ -0,0 +1,170 @@
+#include "Dma2dQueue.hpp"
+#include "Dma2dEngine.hpp"
+
+#include <cstdint>
+
+namespace TFT_LCD {
+    namespace {
+        /** @brief Check whether two rectangles share a pixel. */
+        bool isOverlapping(const Rect& a, const Rect& b){
+            return a.x < b.x + b.width && b.x < a.x + a.width
+                && a.y < b.y + b.height && b.y < a.y + a.height;
+        }
+    }
+
+    Dma2dQueue::Dma2dQueue(DMA2D_HandleTypeDef* hdma2d)
+        : _hdma2d{hdma2d}
+    {
+    }
+
+    Dma2dQueue::Fence Dma2dQueue::push(const Job& job){
+        // Wait for a free slot.
+        while(_submitted.load() - _completed.load() >= MAX_JOBS){
+            Dma2dEngine::idle();
+        }
+
+        const Fence fence = _submitted.load() + 1;
+
+        _jobs[(fence - 1) & (MAX_JOBS - 1)] = job;
+        _submitted.store(fence);
+
+        // When DMA2D is busy, the interrupt of the running job starts this one.
+        if(_isRunning.exchange(true) == false && start(fence) == false){
+            _errorCount = _errorCount + 1;
+            finishJob();
+        }
+
+        return fence;
+    }
+
+    bool Dma2dQueue::start(Fence fence){
+        const Job& job = _jobs[(fence - 1) & (MAX_JOBS - 1)];
+        Dma2dEngine engine(_hdma2d);
+
+        switch(job.kind){
+        case FILL:
+            return engine.startFill(Pixel{static_cast<uint16_t>(job.argument)}, job.destination, job.destinationPitch, job.width, job.height);
+        case COPY:
+            return engine.startCopy(static_cast<const Pixel*>(job.source), job.sourcePitch, job.destination, job.destinationPitch, job.width, job.height);
+        case CONVERT:
+            return engine.startConvert(job.source, job.sourcePitch, job.argument, job.destination, job.destinationPitch, job.width, job.height);
+        case BLEND:
+            return engine.startBlend(static_cast<const Pixel*>(job.source), job.sourcePitch,
+                    job.destination, job.destinationPitch, job.alpha,
+                    job.destination, job.destinationPitch, job.width, job.height);
+        }
+
+        return false;
+    }
+
+    void Dma2dQueue::finishJob(){
+        Fence done = _completed.load() + 1;
+
+        _completed.store(done);
+
+        // Runs with the submitting task suspended (or in it), so `_submitted` cannot change in between.
+        while(static_cast<int32_t>(_submitted.load() - done) > 0){
+            if(start(done + 1) == true){
+                return;
+            }
+
+            // No interrupt will come for a job that did not start: fail it here.
+            _errorCount = _errorCount + 1;
+            done++;
+            _completed.store(done);
+        }
+
+        _isRunning.store(false);
+    }
+
+    Dma2dQueue::Fence Dma2dQueue::fill(FrameBuffer& target, const Rect& area, Pixel color){
+        return push(Job{
+            nullptr, &target.at(area.x, area.y), color.value,
+            0, static_cast<uint16_t>(target.getWidth()),
+            static_cast<uint16_t>(area.width), static_cast<uint16_t>(area.height),
+            0xFF, FILL,
+            target.getBufferAddress(), area, nullptr, Rect{0, 0, 0, 0}
+        });
+    }
+
+    Dma2dQueue::Fence Dma2dQueue::copy(const FrameBuffer& source, const Rect& area, FrameBuffer& target, uint32_t x, uint32_t y){
+        const Pixel* const pixels = static_cast<const Pixel*>(source.getBufferAddress()) + (area.y * source.getWidth()) + area.x;
+
+        return push(Job{
+            pixels, &target.at(x, y), 0,
+            static_cast<uint16_t>(source.getWidth()), static_cast<uint16_t>(target.getWidth()),
+            static_cast<uint16_t>(area.width), static_cast<uint16_t>(area.height),
+            0xFF, COPY,
+            target.getBufferAddress(), Rect{x, y, area.width, area.height}, source.getBufferAddress(), area
+        });
+    }
+
+    Dma2dQueue::Fence Dma2dQueue::convert(const void* source, uint32_t sourcePitch, uint32_t inputColorMode, FrameBuffer& target, const Rect& area){
+        return push(Job{
+            source, &target.at(area.x, area.y), inputColorMode,
+            static_cast<uint16_t>(sourcePitch), static_cast<uint16_t>(target.getWidth()),
+            static_cast<uint16_t>(area.width), static_cast<uint16_t>(area.height),
+            0xFF, CONVERT,
+            target.getBufferAddress(), area, nullptr, Rect{0, 0, 0, 0}
+        });
+    }
+
+    Dma2dQueue::Fence Dma2dQueue::blend(const FrameBuffer& source, const Rect& area, uint8_t alpha, FrameBuffer& target, uint32_t x, uint32_t y){
+        const Pixel* const pixels = static_cast<const Pixel*>(source.getBufferAddress()) + (area.y * source.getWidth()) + area.x;
+
+        return push(Job{
+            pixels, &target.at(x, y), 0,
+            static_cast<uint16_t>(source.getWidth()), static_cast<uint16_t>(target.getWidth()),
+            static_cast<uint16_t>(area.width), static_cast<uint16_t>(area.height),
+            alpha, BLEND,
+            target.getBufferAddress(), Rect{x, y, area.width, area.height}, source.getBufferAddress(), area
+        });
+    }
+
+    void Dma2dQueue::wait(Fence fence){
+        while(isComplete(fence) == false){
+            Dma2dEngine::idle();
+        }
+    }
+
+    void Dma2dQueue::waitForArea(const FrameBuffer& buffer, const Rect& area){
+        const void* const address = buffer.getBufferAddress();
+        const uint32_t completed = _completed.load();
+
+        // Jobs finish in order: waiting for the newest overlapping one is enough.
+        for(Fence fence = _submitted.load(); static_cast<int32_t>(fence - completed) > 0; fence--){
+            const Job& job = _jobs[(fence - 1) & (MAX_JOBS - 1)];
+            const bool isWritten = (job.targetBuffer == address) && isOverlapping(job.targetArea, area);
+            const bool isRead = (job.sourceBuffer == address) && isOverlapping(job.sourceArea, area);
+
+            if(isWritten == true || isRead == true){
+                if(isComplete(fence) == false){
+                    _waitCount++;
+                    wait(fence);
+                }
+                return;
+            }
+        }
+    }
+
+    void Dma2dQueue::waitIdle(){
+        wait(_submitted.load());
+    }
+
+    void Dma2dQueue::onTransferComplete(){
+        if(_isRunning.load() == false){
+            return;
+        }
+
+        finishJob();
+    }
+
+    void Dma2dQueue::onTransferError(){
+        if(_isRunning.load() == false){
+            return;
+        }
+
+        _errorCount = _errorCount + 1;
+        finishJob();
+    }
+}
@@ -1,4 +1,6 @@
 #include "FrameBuffer.hpp"
+#include "Dma2dEngine.hpp"
+#include "Utf8Reader.hpp"
 #include "font/fonts.hpp"
 #include "main.h"
 #include <cstdint>
@@ -6,6 +8,198 @@
 
 
 namespace TFT_LCD {
+    namespace {
+        /** @brief Two packed RGB565 pixels, allowed to alias `Pixel` storage. */
+        using PixelPair = uint32_t __attribute__((__may_alias__));
+
+        /**
+         * @brief Fill a horizontal span, writing two pixels per store.
+         * @param line First pixel of the span.
+         * @param count Span length in pixels.
+         * @param color Fill color.
+         */
+        inline void fillSpan(Pixel* line, uint32_t count, Pixel color){
+            if(count != 0 && (reinterpret_cast<uintptr_t>(line) & 0x2) != 0){
+                *line++ = color;
+                count--;
+            }
+
+            PixelPair* pair = reinterpret_cast<PixelPair*>(line);
+            const uint32_t packed = color.value | (static_cast<uint32_t>(color.value) << 16);
+
+            for(uint32_t idx = 0; idx < count / 2; idx++){
+                pair[idx] = packed;
+            }
+
+            if((count & 0x1) != 0){
+                line[count - 1] = color;
+            }
+        }
+
+        /**
+         * @brief Visit the runs of set bits in a glyph row mask.
+         * @param mask Row mask, most significant bit first (bit 31 is column 0).
+         * @param visit Called with the first and one-past-last column of each run.
+         */
+        template<typename Visitor>
+        inline void forEachRun(uint32_t mask, Visitor&& visit){
+            while(mask != 0){
+                const uint32_t start = __builtin_clz(mask);
+                const uint32_t inverted = ~(mask << start);
+                const uint32_t end = start + ((inverted == 0) ? (32 - start) : __builtin_clz(inverted));
+
+                visit(start, end);
+
+                mask = (end >= 32) ? 0 : (mask & (0xFFFFFFFF >> end));
+            }
+        }
+
+        /**
+         * @brief Paint the set bits of a glyph row mask as horizontal runs.
+         * @param line First pixel of the row; bit 31 of `mask` maps to `line[0]`.
+         * @param mask Row mask, most significant bit first.
+         * @param color Run color.
+         */
+        void fillRowMask(Pixel* const line, uint32_t mask, Pixel color){
+            forEachRun(mask, [&](uint32_t start, uint32_t end){
+                fillSpan(&line[start], end - start, color);
+            });
+        }
+
+        /**
+         * @brief Load one `sFONT` glyph row as a left-aligned 32-bit mask.
+         * @param row First byte of the row.
+         * @param widthBytes Bytes per row (1..4).
+         * @return Row mask, column 0 in bit 31.
+         */
+        inline uint32_t loadRowMask(const uint8_t* row, uint32_t widthBytes){
+            uint32_t mask = 0;
+
+            for(uint32_t byteIdx = 0; byteIdx < widthBytes; byteIdx++){
+                mask = (mask << 8) | row[byteIdx];
+            }
+
+            return mask << (32 - (widthBytes * 8));
+        }
+
+        /**
+         * @brief Get the row mask bits that belong to a glyph of a given width.
+         * @details Bitmap rows are padded to whole bytes; the padding bits are not glyph pixels.
+         * @param width Glyph width in pixels (1..32).
+         * @return Mask with the top `width` bits set.
+         */
+        inline uint32_t columnMask(uint32_t width){
+            return (width >= 32) ? 0xFFFFFFFF : ~(0xFFFFFFFF >> width);
+        }
+
+        /** @brief Longest `putNumber` field: sign, 10 digits, point, leading zero, padding. */
+        constexpr uint32_t NUMBER_BUFFER_SIZE = 32;
+
+        /**
+         * @brief Format a fixed-point number right-aligned into a buffer.
+         * @param value Number scaled by `10^format.decimals`.
+         * @param format Field layout.
+         * @param buffer Output buffer; the text ends at `buffer + NUMBER_BUFFER_SIZE`.
+         * @return First character of the formatted text.
+         */
+        char* formatNumber(int32_t value, const NumberFormat& format, char (&buffer)[NUMBER_BUFFER_SIZE]){
+            char* const end = buffer + NUMBER_BUFFER_SIZE;
+            char* cursor = end;
+
+            const bool isNegative = value < 0;
+            uint32_t magnitude = isNegative ? (0U - static_cast<uint32_t>(value)) : static_cast<uint32_t>(value);
+            const uint32_t decimals = (format.decimals > 10) ? 10 : format.decimals;
+
+            for(uint32_t digit = 0; digit < decimals; digit++){
+                *--cursor = static_cast<char>('0' + (magnitude % 10));
+                magnitude /= 10;
+            }
+
+            if(decimals > 0){
+                *--cursor = '.';
+            }
+
+            do{
+                *--cursor = static_cast<char>('0' + (magnitude % 10));
+                magnitude /= 10;
+            } while(magnitude != 0);
+
+            const char sign = isNegative ? '-' : (format.showPlus ? '+' : 0);
+            const uint32_t signLength = (sign != 0) ? 1 : 0;
+            const uint32_t width = (format.width > NUMBER_BUFFER_SIZE) ? NUMBER_BUFFER_SIZE : format.width;
+
+            if(format.padding == '0'){
+                while(static_cast<uint32_t>(end - cursor) + signLength < width){
+                    *--cursor = '0';
+                }
+            }
+
+            if(sign != 0){
+                *--cursor = sign;
+            }
+
+            while(static_cast<uint32_t>(end - cursor) < width){
+                *--cursor = ' ';
+            }
+
+            return cursor;
+        }
+
+        /**
+         * @brief Walk the glyphs of a text string in pen order.
+         * @param text Text to lay out.
+         * @param font Proportional font layout.
+         * @param penX Initial pen X coordinate.
+         * @param visit Called with each glyph and its pen X coordinate.
+         * @return Pen X coordinate after the last glyph.
+         */
+        template<typename Visitor>
+        int32_t forEachGlyph(std::string_view text, const ProportionalFont& font, int32_t penX, Visitor&& visit){
+            int32_t previous = -1;
+            Utf8Reader reader(text);
+
+            while(reader.hasNext()){
+                const int32_t glyphIndex = font.getGlyphIndex(reader.next());
+
+                if(glyphIndex < 0){
+                    previous = -1;
+                    continue;
+                }
+
+                if(previous >= 0){
+                    penX += font.getKerning(previous, glyphIndex);
+                }
+
+                const GlyphMetrics& glyph = font.glyphs[glyphIndex];
+                visit(glyph, penX);
+
+                penX += glyph.advance;
+                previous = glyphIndex;
+            }
+
+            return penX;
+        }
+
+        /** @brief 4-bit coverage mapped to the 0..32 weight used by `blendPixel`. */
+        constexpr uint8_t COVERAGE_WEIGHT_4BIT[16] = {
+            0, 2, 4, 6, 9, 11, 13, 15, 17, 19, 21, 23, 26, 28, 30, 32
+        };
+
+        /**
+         * @brief Blend a foreground color over an RGB565 pixel.
+         * @param background Background pixel.
+         * @param foreground Foreground color spread by `(c | c << 16) & 0x07E0F81F`.
+         * @param weight Foreground weight, 0..32.
+         * @return Blended pixel.
+         */
+        inline uint16_t blendPixel(uint16_t background, uint32_t foreground, uint32_t weight){
+            const uint32_t spread = (background | (background << 16)) & 0x07E0F81F;
+            const uint32_t result = ((((foreground - spread) * weight) >> 5) + spread) & 0x07E0F81F;
+
+            return static_cast<uint16_t>(result | (result >> 16));
+        }
+    }
+
     FrameBuffer::FrameBuffer(uint16_t* const buffer, uint32_t width, uint32_t height,PixelFormat format)
         : _buffer{reinterpret_cast<Pixel*>(buffer)}, _width{width}, _height{height}, _pixelFormat(format)
     {
@@ -51,14 +245,59 @@ namespace TFT_LCD {
                     _height*_width*_pixelFormat);
         }
         else{
-                HAL_DMA2D_Start(
-                        hdma2d,
-                        (uint32_t)other.getBufferAddress(),   // Source
-                        (uint32_t)this->getBufferAddress(),  // Destination (LTDC가 읽음)
-                        _width,
-                        _height);
+            Dma2dEngine(hdma2d).copy(other._buffer, other._width, _buffer, _width, _width, _height);
+        }
+    }
+
+    void FrameBuffer::copyRect(const FrameBuffer& other,const Rect& area,DMA2D_HandleTypeDef * hdma2d){
+        const Pixel* source = &other._buffer[(area.y * other._width) + area.x];
+        Pixel* destination = &at(area.x, area.y);
+
+        if(hdma2d != nullptr){
+            Dma2dEngine(hdma2d).copy(source, other._width, destination, _width, area.width, area.height);
+            return;
+        }
+
+        for(uint32_t iy = 0; iy < area.height; iy++, source += other._width, destination += _width){
+            memcpy(destination, source, area.width * sizeof(Pixel));
+        }
+    }
+
+    void FrameBuffer::upscale2x(const FrameBuffer& source){
+        if((2 * source._width) > _width || (2 * source._height) > _height){
+            return;
+        }
+
+        const uint32_t width = source._width;
+        const uint32_t rowBytes = 2 * width * sizeof(Pixel);
+        const uint16_t* input = reinterpret_cast<const uint16_t*>(source._buffer);
+        uint8_t* output = reinterpret_cast<uint8_t*>(_buffer);
+
+        for(uint32_t iy = 0; iy < source._height; iy++, output += 2 * _width * sizeof(Pixel)){
+            uint8_t* word = output;
+
+            // Two source pixels per load; memcpy compiles to single word accesses.
+            uint32_t ix = 0;
+
+            for(; ix + 1 < width; ix += 2, word += 8){
+                uint32_t pair;
+                memcpy(&pair, &input[ix], sizeof(pair));
+
+                const uint32_t left = pair & 0xFFFF;
+                const uint32_t right = pair >> 16;
+                const uint32_t doubled[2] = {left | (left << 16), right | (right << 16)};
+
+                memcpy(word, doubled, sizeof(doubled));
+            }
+
+            if(ix < width){
+                const uint32_t doubled = input[ix] | (static_cast<uint32_t>(input[ix]) << 16);
+
+                memcpy(word, &doubled, sizeof(doubled));
+            }
 
-                HAL_DMA2D_PollForTransfer(hdma2d, HAL_MAX_DELAY);
+            memcpy(output + (_width * sizeof(Pixel)), output, rowBytes);
+            input += width;
         }
     }
 
@@ -74,13 +313,66 @@ namespace TFT_LCD {
         }
     }
 
-    void FrameBuffer::putText(std::string text,uint32_t x,uint32_t y,const sFONT& font,Pixel color){
-        for(size_t idx = 0; idx < text.size();idx++){
-            putChar(text[idx] ,x + (idx * font.Width) ,y ,font,color);
+    void FrameBuffer::putText(std::string_view text,uint32_t x,uint32_t y,const sFONT& font,Pixel color){
+        Utf8Reader reader(text);
+
+        for(uint32_t cellX = x; reader.hasNext(); cellX += font.Width){
+            const uint32_t codepoint = reader.next();
+
+            if(codepoint <= 0xFF){
+                putChar(static_cast<uint8_t>(codepoint) ,cellX ,y ,font,color);
+            }
+        }
+    }
+
+    uint32_t FrameBuffer::measureText(std::string_view text,const sFONT& font){
+        Utf8Reader reader(text);
+        uint32_t count = 0;
+
+        for(; reader.hasNext(); count++){
+            reader.next();
+        }
+
+        return count * font.Width;
+    }
+
+    uint32_t FrameBuffer::putNumber(int32_t value, uint32_t x,uint32_t y,const sFONT& font,Pixel color,NumberFormat format){
+        char buffer[NUMBER_BUFFER_SIZE];
+        const char* const end = buffer + NUMBER_BUFFER_SIZE;
+
+        uint32_t cellX = x;
+
+        for(const char* cursor = formatNumber(value, format, buffer); cursor != end; cursor++, cellX += font.Width){
+            putChar(static_cast<uint8_t>(*cursor), cellX, y, font, color);
+        }
+
+        return cellX - x;
+    }
+
+    uint32_t FrameBuffer::putNumber(int32_t value, uint32_t x,uint32_t y,const CompactFont& font,Pixel color,NumberFormat format){
+        char buffer[NUMBER_BUFFER_SIZE];
+        const char* const end = buffer + NUMBER_BUFFER_SIZE;
+
+        uint32_t cellX = x;
+
+        for(const char* cursor = formatNumber(value, format, buffer); cursor != end; cursor++, cellX += font.cellWidth){
+            putChar(static_cast<uint8_t>(*cursor), cellX, y, font, color);
         }
+
+        return cellX - x;
+    }
+
+    uint32_t FrameBuffer::getNumberLength(int32_t value, NumberFormat format){
+        char buffer[NUMBER_BUFFER_SIZE];
+
+        return static_cast<uint32_t>((buffer + NUMBER_BUFFER_SIZE) - formatNumber(value, format, buffer));
     }
 
     void FrameBuffer::putChar(uint8_t character,uint32_t x,uint32_t y,const sFONT& font,Pixel color){
+        if(character < ' ' || character > '~'){
+            return;
+        }
+
         const size_t widthBytes = ((font.Width - 1) / 8) + 1;
         const size_t charBytes = widthBytes * font.Height;
 
@@ -99,4 +391,226 @@ namespace TFT_LCD {
             }
         }
     }
+
+    void FrameBuffer::putChar(uint8_t character,uint32_t x,uint32_t y,const sFONT& font,Pixel color,Pixel background){
+        const uint32_t widthBytes = ((font.Width - 1) / 8) + 1;
+        const bool isPrintable = (character >= ' ' && character <= '~');
+        const uint8_t* row = &font.table[widthBytes * font.Height * (isPrintable ? (character - ' ') : 0)];
+        const uint32_t widthMask = columnMask(font.Width);
+
+        for(uint32_t iy = 0; iy < font.Height; iy++, row += widthBytes){
+            Pixel* const line = &at(x, y + iy);
+
+            fillSpan(line, font.Width, background);
+
+            if(isPrintable == true){
+                fillRowMask(line, loadRowMask(row, widthBytes) & widthMask, color);
+            }
+        }
+    }
+
+    void FrameBuffer::putText(std::string_view text,uint32_t x,uint32_t y,const ProportionalFont& font,Pixel color){
+        forEachGlyph(text, font, static_cast<int32_t>(x), [&](const GlyphMetrics& glyph, int32_t penX){
+            drawGlyph(font, glyph, penX, y, color);
+        });
+    }
+
+    void FrameBuffer::putChar(uint32_t codepoint,uint32_t x,uint32_t y,const ProportionalFont& font,Pixel color){
+        const int32_t glyphIndex = font.getGlyphIndex(codepoint);
+
+        if(glyphIndex < 0){
+            return;
+        }
+
+        drawGlyph(font, font.glyphs[glyphIndex], static_cast<int32_t>(x), y, color);
+    }
+
+    uint32_t FrameBuffer::measureText(std::string_view text,const ProportionalFont& font){
+        const int32_t width = forEachGlyph(text, font, 0, [](const GlyphMetrics&, int32_t){});
+
+        return width > 0 ? static_cast<uint32_t>(width) : 0;
+    }
+
+    void FrameBuffer::drawGlyph(const ProportionalFont& font,const GlyphMetrics& glyph,int32_t penX,uint32_t y,Pixel color){
+        if(glyph.width == 0){
+            return;
+        }
+
+        const uint32_t rowBytes = (glyph.width + 7) / 8;
+        const uint8_t* row = &font.table[glyph.offset];
+
+        int32_t left = penX + glyph.bearingX;
+        uint32_t clipBits = 0;
+
+        // Bitmap columns left of the frame edge are dropped from each row mask.
+        if(left < 0){
+            clipBits = static_cast<uint32_t>(-left);
+            left = 0;
+        }
+
+        if(clipBits >= glyph.width){
+            return;
+        }
+
+        const uint32_t widthMask = columnMask(glyph.width);
+
+        for(uint32_t iy = 0; iy < font.height; iy++, row += rowBytes){
+            const uint32_t mask = (loadRowMask(row, rowBytes) & widthMask) << clipBits;
+
+            fillRowMask(&at(left, y + iy), mask, color);
+        }
+    }
+
+    void FrameBuffer::putText(std::string_view text,uint32_t x,uint32_t y,const AntiAliasedFont& font,Pixel color,DMA2D_HandleTypeDef * hdma2d){
+        forEachGlyph(text, font.layout, static_cast<int32_t>(x), [&](const GlyphMetrics& glyph, int32_t penX){
+            blendGlyph(font, glyph, penX, y, color, hdma2d);
+        });
+    }
+
+    void FrameBuffer::putChar(uint32_t codepoint,uint32_t x,uint32_t y,const AntiAliasedFont& font,Pixel color,DMA2D_HandleTypeDef * hdma2d){
+        const int32_t glyphIndex = font.layout.getGlyphIndex(codepoint);
+
+        if(glyphIndex < 0){
+            return;
+        }
+
+        blendGlyph(font, font.layout.glyphs[glyphIndex], static_cast<int32_t>(x), y, color, hdma2d);
+    }
+
+    uint32_t FrameBuffer::measureText(std::string_view text,const AntiAliasedFont& font){
+        return measureText(text, font.layout);
+    }
+
+    void FrameBuffer::blendGlyph(const AntiAliasedFont& font,const GlyphMetrics& glyph,int32_t penX,uint32_t y,Pixel color,DMA2D_HandleTypeDef * hdma2d){
+        if(glyph.width == 0){
+            return;
+        }
+
+        const bool is4Bit = (font.bitsPerPixel == 4);
+        const uint32_t rowBytes = is4Bit ? ((glyph.width + 1) / 2) : glyph.width;
+        const uint8_t* row = &font.layout.table[glyph.offset];
+        const int32_t left = penX + glyph.bearingX;
+
+        if(hdma2d != nullptr && left >= 0 && (glyph.width * font.layout.height) >= DMA2D_BLEND_MIN_PIXELS){
+            // A4 rows are padded to an even width; the pad column has zero coverage.
+            Dma2dEngine(hdma2d).blend(
+                    row,
+                    is4Bit ? Dma2dEngine::A4 : Dma2dEngine::A8,
+                    color,
+                    &at(left, y),
+                    _width,
+                    is4Bit ? (rowBytes * 2) : glyph.width,
+                    font.layout.height);
+            return;
+        }
+
+        const uint32_t foreground = (color.value | (color.value << 16)) & 0x07E0F81F;
+        const uint32_t firstColumn = (left < 0) ? static_cast<uint32_t>(-left) : 0;
+
+        for(uint32_t iy = 0; iy < font.layout.height; iy++, row += rowBytes){
+            Pixel* const line = &at(0, y + iy) + left;
+
+            for(uint32_t ix = firstColumn; ix < glyph.width; ix++){
+                const uint32_t weight = is4Bit
+                    ? COVERAGE_WEIGHT_4BIT[(row[ix / 2] >> ((ix % 2) * 4)) & 0x0F]
+                    : ((row[ix] + 4) >> 3);
+
+                if(weight == 0){
+                    continue;
+                }
+
+                line[ix] = (weight >= 32) ? color.value : blendPixel(line[ix].value, foreground, weight);
+            }
+        }
+    }
+
+    void FrameBuffer::putTextScaled(std::string_view text,uint32_t x,uint32_t y,const sFONT& font,Pixel color,uint32_t scale){
+        Utf8Reader reader(text);
+        const uint32_t cellWidth = font.Width * scale;
+
+        for(uint32_t cellX = x; reader.hasNext(); cellX += cellWidth){
+            const uint32_t codepoint = reader.next();
+
+            if(codepoint <= 0xFF){
+                putCharScaled(static_cast<uint8_t>(codepoint), cellX, y, font, color, scale);
+            }
+        }
+    }
+
+    void FrameBuffer::putCharScaled(uint8_t character,uint32_t x,uint32_t y,const sFONT& font,Pixel color,uint32_t scale){
+        if(character < ' ' || character > '~' || scale == 0){
+            return;
+        }
+
+        const size_t widthBytes = ((font.Width - 1) / 8) + 1;
+        const uint8_t* row = &font.table[widthBytes * font.Height * (character - ' ')];
+
+        const uint32_t widthMask = columnMask(font.Width);
+
+        Pixel* line = &at(x, y);
+        const uint32_t blockPitch = _width * scale;
+
+        for(uint32_t iy = 0; iy < font.Height; iy++, row += widthBytes, line += blockPitch){
+            // Paint each run once at full scaled width, then copy it down the
+            // remaining rows of the block; pixels between runs stay untouched.
+            forEachRun(loadRowMask(row, widthBytes) & widthMask, [&](uint32_t start, uint32_t end){
+                Pixel* const span = &line[start * scale];
+                const uint32_t spanPixels = (end - start) * scale;
+
+                fillSpan(span, spanPixels, color);
+
+                for(uint32_t repeat = 1; repeat < scale; repeat++){
+                    memcpy(&span[repeat * _width], span, spanPixels * sizeof(Pixel));
+                }
+            });
+        }
+    }
+
+    void FrameBuffer::putText(std::string_view text,uint32_t x,uint32_t y,const CompactFont& font,Pixel color){
+        Utf8Reader reader(text);
+
+        for(uint32_t cellX = x; reader.hasNext(); cellX += font.cellWidth){
+            putChar(reader.next(), cellX, y, font, color);
+        }
+    }
+
+    uint32_t FrameBuffer::measureText(std::string_view text,const CompactFont& font){
+        Utf8Reader reader(text);
+        uint32_t count = 0;
+
+        for(; reader.hasNext(); count++){
+            reader.next();
+        }
+
+        return count * font.cellWidth;
+    }
+
+    void FrameBuffer::putChar(uint32_t codepoint,uint32_t x,uint32_t y,const CompactFont& font,Pixel color){
+        const int32_t glyphIndex = font.index.find(codepoint);
+
+        if(glyphIndex < 0){
+            return;
+        }
+
+        const CompactGlyph& glyph = font.glyphs[glyphIndex];
+        const uint8_t* data = &font.data[glyph.offset];
+
+        Pixel* line = &at(x + glyph.x, y + glyph.y);
+
+        // Rows are not byte aligned: keep unread bits left-aligned in `bits`.
+        uint32_t bits = 0;
+        uint32_t bitCount = 0;
+
+        for(uint32_t iy = 0; iy < glyph.height; iy++, line += _width){
+            while(bitCount < glyph.width){
+                bits |= static_cast<uint32_t>(*data++) << (24 - bitCount);
+                bitCount += 8;
+            }
+
+            fillRowMask(line, bits & ~(0xFFFFFFFF >> glyph.width), color);
+
+            bits <<= glyph.width;
+            bitCount -= glyph.width;
+        }
+    }
 }
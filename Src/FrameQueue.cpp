@@ -0,0 +1,121 @@
+#include "FrameQueue.hpp"
+
+#include <cstdint>
+
+namespace TFT_LCD {
+    void FrameQueue::attach(FrameBuffer* buffers, uint32_t count){
+        _buffers = buffers;
+        _count = (count > MAX_BUFFERS) ? MAX_BUFFERS : count;
+
+        for(uint32_t idx = 0; idx < _count; idx++){
+            _staleAreas[idx] = DamageList(buffers[idx].getWidth(), buffers[idx].getHeight());
+
+            // Everything but the displayed buffer starts with unknown contents.
+            if(idx != 0){
+                _staleAreas[idx].addAll();
+            }
+        }
+
+        _queued.store(NO_BUFFER);
+        _displayed.store(0);
+        _lastSubmitted = 0;
+        _render = 1;
+
+        resetStatistics();
+    }
+
+    bool FrameQueue::submit(const DamageList& damage, uint32_t now){
+        for(uint32_t idx = 0; idx < _count; idx++){
+            if(idx == _render){
+                continue;
+            }
+
+            for(uint32_t rect = 0; rect < damage.getCount(); rect++){
+                _staleAreas[idx].add(damage.getRect(rect));
+            }
+        }
+
+        _lastSubmitted = _render;
+        _render = NO_BUFFER;
+
+        const uint32_t previous = _queued.exchange(_lastSubmitted);
+
+        if(_statistics.submittedFrames > 0){
+            const uint32_t frameTime = now - _lastSubmitTick;
+
+            _statistics.lastFrameTime = frameTime;
+
+            if(frameTime > _statistics.maxFrameTime){
+                _statistics.maxFrameTime = frameTime;
+            }
+        }
+
+        _statistics.submittedFrames++;
+        _lastSubmitTick = now;
+
+        if(previous != NO_BUFFER){
+            _statistics.droppedFrames++;
+            return true;
+        }
+
+        return false;
+    }
+
+    bool FrameQueue::tryAcquire(){
+        // Queued before displayed: a vblank in between only moves the queued
+        // buffer to displayed, so nothing busy can be missed.
+        const uint32_t queued = _queued.load();
+        const uint32_t displayed = _displayed.load();
+
+        for(uint32_t idx = 0; idx < _count; idx++){
+            if(idx != queued && idx != displayed && idx != _lastSubmitted){
+                _render = idx;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool FrameQueue::reclaimQueued(){
+        const uint32_t queued = _queued.exchange(NO_BUFFER);
+
+        if(queued == NO_BUFFER){
+            return false;
+        }
+
+        _render = queued;
+        _statistics.droppedFrames++;
+
+        return true;
+    }
+
+    void FrameQueue::refreshRenderBuffer(DMA2D_HandleTypeDef* hdma2d){
+        DamageList& stale = _staleAreas[_render];
+        const FrameBuffer& newest = _buffers[_lastSubmitted];
+
+        for(uint32_t idx = 0; idx < stale.getCount(); idx++){
+            _buffers[_render].copyRect(newest, stale.getRect(idx), hdma2d);
+        }
+
+        stale.clear();
+    }
+
+    const FrameBuffer* FrameQueue::takeQueued(){
+        const uint32_t queued = _queued.exchange(NO_BUFFER);
+
+        if(queued == NO_BUFFER){
+            return nullptr;
+        }
+
+        _displayed.store(queued);
+        _statistics.displayedFrames++;
+
+        return &_buffers[queued];
+    }
+
+    void FrameQueue::resetStatistics(){
+        _statistics = Statistics{};
+        _lastSubmitTick = 0;
+    }
+}
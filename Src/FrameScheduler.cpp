@@ -0,0 +1,161 @@
+#include "FrameScheduler.hpp"
+#include "main.h"
+
+#include <cstdint>
+
+namespace TFT_LCD {
+    FrameScheduler::FrameScheduler(ILI9341& display, uint32_t refreshRate)
+        : _display{display}, _refreshRate{(refreshRate != 0) ? refreshRate : 60}
+    {
+        _displayVBlankCount = _display.getVBlankCount();
+        _statistics.frameBudget = 1000 / _refreshRate;
+    }
+
+    uint32_t FrameScheduler::toPeriod(uint32_t rate) const {
+        if(rate == 0 || rate >= _refreshRate){
+            return 1;
+        }
+
+        return _refreshRate / rate;
+    }
+
+    void FrameScheduler::updateVBlankCount(bool hasWaited){
+        const uint32_t count = _display.getVBlankCount();
+
+        if(count != _displayVBlankCount){
+            _vblankCount += count - _displayVBlankCount;
+            _displayVBlankCount = count;
+        }
+        else if(hasWaited == true){
+            _vblankCount++;
+        }
+    }
+
+    uint32_t FrameScheduler::addRegion(const Rect& area, DrawFunction draw, void* context, uint32_t rate, UpdateMode mode){
+        if(_regionCount == MAX_REGIONS || draw == nullptr){
+            return NO_REGION;
+        }
+
+        const uint32_t index = _regionCount;
+        Region& region = _regions[index];
+
+        region.area = area;
+        region.draw = draw;
+        region.context = context;
+        region.period = toPeriod(rate);
+        region.lastDraw = _vblankCount - region.period;
+        region.mode = mode;
+
+        _regionCount++;
+        invalidate(index);
+
+        return index;
+    }
+
+    void FrameScheduler::invalidate(uint32_t region){
+        if(region < MAX_REGIONS){
+            _invalidated.fetch_or(static_cast<uint32_t>(1) << region);
+        }
+    }
+
+    void FrameScheduler::invalidateAll(){
+        _invalidated.fetch_or((static_cast<uint32_t>(1) << _regionCount) - 1);
+    }
+
+    void FrameScheduler::setTargetRate(uint32_t rate){
+        _interval = toPeriod(rate);
+        _statistics.frameBudget = (_interval * 1000) / _refreshRate;
+    }
+
+    bool FrameScheduler::runFrame(){
+        updateVBlankCount(false);
+
+        while(static_cast<int32_t>(_vblankCount - _nextSlot) < 0){
+            if(_display.waitForVBlank() == false){
+                return false;
+            }
+
+            updateVBlankCount(true);
+        }
+
+        const uint32_t slot = _vblankCount;
+
+        _nextSlot += _interval;
+
+        if(static_cast<int32_t>(slot - _nextSlot) >= 0){
+            // Far behind (first call or long stall): restart the slot grid here.
+            _nextSlot = slot + _interval;
+        }
+
+        _pending |= _invalidated.exchange(0);
+
+        uint32_t due = 0;
+
+        for(uint32_t idx = 0; idx < _regionCount; idx++){
+            const Region& region = _regions[idx];
+            const uint32_t mask = static_cast<uint32_t>(1) << idx;
+            const bool isRateReady = (slot - region.lastDraw) >= region.period;
+
+            if(region.mode == PERIODIC && isRateReady == true){
+                _pending |= mask;
+            }
+
+            if((_pending & mask) != 0 && isRateReady == true){
+                due |= mask;
+            }
+        }
+
+        if(due == 0){
+            _statistics.idleSlots++;
+            return false;
+        }
+
+        _pending &= ~due;
+
+        const uint32_t start = HAL_GetTick();
+
+        _display.beginFrame();
+
+        for(uint32_t idx = 0; idx < _regionCount; idx++){
+            if((due & (static_cast<uint32_t>(1) << idx)) != 0){
+                Region& region = _regions[idx];
+
+                region.draw(_display, region.area, region.context);
+                region.lastDraw = slot;
+                _statistics.drawnRegions++;
+            }
+        }
+
+        _display.endFrame();
+
+        const uint32_t frameTime = HAL_GetTick() - start;
+
+        _statistics.presentedFrames++;
+        _statistics.lastFrameTime = frameTime;
+
+        if(frameTime > _statistics.maxFrameTime){
+            _statistics.maxFrameTime = frameTime;
+        }
+
+        // A frame is late when the vblank of the next slot passed before it was presented.
+        updateVBlankCount(false);
+
+        if(static_cast<int32_t>(_vblankCount - slot) > static_cast<int32_t>(_interval)){
+            _statistics.deadlineMisses++;
+
+            while(static_cast<int32_t>(_vblankCount - _nextSlot) > 0){
+                _nextSlot += _interval;
+                _statistics.skippedSlots++;
+            }
+        }
+
+        return true;
+    }
+
+    void FrameScheduler::resetStatistics(){
+        const uint32_t frameBudget = _statistics.frameBudget;
+
+        _statistics = Statistics{};
+        _statistics.frameBudget = frameBudget;
+    }
+}
@@ -0,0 +1,117 @@
+#include "GlyphCache.hpp"
+#include "Dma2dEngine.hpp"
+#include "Utf8Reader.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+namespace TFT_LCD {
+    GlyphCache::GlyphCache(uint16_t* arena, uint32_t arenaPixels, uint32_t slotPixels, DMA2D_HandleTypeDef* hdma2d)
+        : _arena{reinterpret_cast<Pixel*>(arena)}, _slotPixels{slotPixels}, _hdma2d{hdma2d}
+    {
+        _slotCount = (slotPixels == 0) ? 0 : (arenaPixels / slotPixels);
+
+        if(_slotCount > MAX_SLOTS){
+            _slotCount = MAX_SLOTS;
+        }
+    }
+
+    void GlyphCache::expandGlyph(Pixel* cell, uint32_t pitch, uint8_t character, const sFONT& font, Pixel color, Pixel background){
+        const size_t widthBytes = ((font.Width - 1) / 8) + 1;
+        const bool isPrintable = (character >= ' ' && character <= '~');
+        const uint8_t* row = &font.table[widthBytes * font.Height * (isPrintable ? (character - ' ') : 0)];
+
+        for(uint32_t iy = 0; iy < font.Height; iy++, row += widthBytes, cell += pitch){
+            for(uint32_t ix = 0; ix < font.Width; ix++){
+                const bool curBit = isPrintable && ((0x80 >> (ix % 8)) & row[ix / 8]);
+                cell[ix] = curBit ? color : background;
+            }
+        }
+    }
+
+    const Pixel* GlyphCache::lookup(uint8_t character, const sFONT& font, Pixel color, Pixel background){
+        const uint32_t cellPixels = font.Width * font.Height;
+
+        if(cellPixels > _slotPixels || _slotCount == 0){
+            return nullptr;
+        }
+
+        _useClock++;
+
+        uint32_t victim = 0;
+
+        for(uint32_t idx = 0; idx < _slotCount; idx++){
+            Slot& slot = _slots[idx];
+
+            if(slot.font == &font && slot.character == character
+                && slot.color == color.value && slot.background == background.value){
+                slot.lastUse = _useClock;
+                _hitCount++;
+                return &_arena[idx * _slotPixels];
+            }
+
+            if(slot.lastUse < _slots[victim].lastUse){
+                victim = idx;
+            }
+        }
+
+        Slot& slot = _slots[victim];
+        slot.font = &font;
+        slot.character = character;
+        slot.color = color.value;
+        slot.background = background.value;
+        slot.lastUse = _useClock;
+        _missCount++;
+
+        Pixel* const cell = &_arena[victim * _slotPixels];
+        expandGlyph(cell, font.Width, character, font, color, background);
+
+        return cell;
+    }
+
+    void GlyphCache::putChar(FrameBuffer& target, uint8_t character, uint32_t x, uint32_t y, const sFONT& font, Pixel color, Pixel background){
+        const Pixel* const cell = lookup(character, font, color, background);
+        const uint32_t pitch = target.getWidth();
+
+        if(cell == nullptr){
+            _missCount++;
+            expandGlyph(&target.at(x, y), pitch, character, font, color, background);
+            return;
+        }
+
+        if(_hdma2d != nullptr){
+            Dma2dEngine(_hdma2d).copy(cell, font.Width, &target.at(x, y), pitch, font.Width, font.Height);
+            return;
+        }
+
+        Pixel* line = &target.at(x, y);
+
+        for(uint32_t iy = 0; iy < font.Height; iy++, line += pitch){
+            memcpy(line, &cell[iy * font.Width], font.Width * sizeof(Pixel));
+        }
+    }
+
+    void GlyphCache::putText(FrameBuffer& target, std::string_view text, uint32_t x, uint32_t y, const sFONT& font, Pixel color, Pixel background){
+        Utf8Reader reader(text);
+
+        for(uint32_t cellX = x; reader.hasNext(); cellX += font.Width){
+            const uint32_t codepoint = reader.next();
+            const uint8_t character = (codepoint <= '~') ? static_cast<uint8_t>(codepoint) : ' ';
+
+            putChar(target, character, cellX, y, font, color, background);
+        }
+    }
+
+    void GlyphCache::clear(){
+        for(uint32_t idx = 0; idx < _slotCount; idx++){
+            _slots[idx] = Slot{};
+        }
+
+        _useClock = 0;
+    }
+
+    void GlyphCache::resetStatistics(){
+        _hitCount = 0;
+        _missCount = 0;
+    }
+}
@@ -1,6 +1,8 @@
 
 #include "ILI9341.hpp"
+#include "Dma2dEngine.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <cstring>
@@ -66,7 +68,7 @@ namespace TFT_LCD {
 
     // public method
     ILI9341::ILI9341(ILI9341_Config config)
-        : config{config}
+        : _dma2dQueue{config.hdma2d}, config{config}
     {
         ASSERT_PARAM(config.hspi != nullptr);
         ASSERT_PARAM(config.CS.Port != nullptr);
@@ -79,6 +81,14 @@ namespace TFT_LCD {
     URL : https://github.com/STMicroelectronics/stm32-ili9341/blob/main/ili9341.c
     */
     void ILI9341::initalize(uint16_t* FrameBufferAddress){
+#ifdef USE_FREERTOS
+        _reloadSemaphore = xSemaphoreCreateBinaryStatic(&_reloadSemaphoreBuffer);
+        _lineEventSemaphore = xSemaphoreCreateBinaryStatic(&_lineEventSemaphoreBuffer);
+        _lineEventMutex = xSemaphoreCreateMutexStatic(&_lineEventMutexBuffer);
+        _presentSemaphore = xSemaphoreCreateBinaryStatic(&_presentSemaphoreBuffer);
+        _dma2dSemaphore = xSemaphoreCreateBinaryStatic(&_dma2dSemaphoreBuffer);
+        Dma2dEngine::setWaitHandler(waitForDma2d, this);
+#endif
 
         /* Configure LCD */
         {
@@ -347,9 +357,30 @@ namespace TFT_LCD {
         _FrameBuffer[1] = backFrame;
 
         _hasBackFrame = true;
+
+        // Nothing is known about the new buffer: the first swap copies the whole frame back.
+        _damage.addAll();
     }
 
-    void ILI9341::setLayer(uint32_t layerIndex,const FrameBuffer& frameBuffer, uint32_t left, uint32_t top){
+    void ILI9341::setQueuedFrameBuffers(std::span<uint16_t* const> backFrameBuffers){
+        const uint32_t count = (backFrameBuffers.size() < FRAME_BUFFER_COUNT) ? backFrameBuffers.size() : (FRAME_BUFFER_COUNT - 1);
+
+        ASSERT_PARAM(count > 0);
+
+        for(uint32_t idx = 0; idx < count; idx++){
+            _FrameBuffer[idx + 1] = FrameBuffer(backFrameBuffers[idx],LCD_WIDTH,LCD_HEIGHT);
+        }
+
+        _hasBackFrame = true;
+        _damage.clear();
+
+        _frameQueue.attach(_FrameBuffer, count + 1);
+        _frameQueue.refreshRenderBuffer(config.hdma2d);
+
+        programLineEvent(getVBlankLine());
+    }
+
+    void ILI9341::setLayer(uint32_t layerIndex,const FrameBuffer& frameBuffer, uint32_t left, uint32_t top, uint8_t alpha){
         LTDC_LayerCfgTypeDef Layercfg;
 
         /* Layer Init */
@@ -359,7 +390,7 @@ namespace TFT_LCD {
         Layercfg.WindowY1 = top + frameBuffer.getHeight();
         Layercfg.PixelFormat = LTDC_PIXEL_FORMAT_RGB565;
         Layercfg.FBStartAdress = reinterpret_cast<uint32_t>(frameBuffer.getBufferAddress());
-        Layercfg.Alpha = 255;
+        Layercfg.Alpha = alpha;
 
         Layercfg.Alpha0 = 0;
         Layercfg.Backcolor.Blue = 0;
@@ -378,49 +409,780 @@ namespace TFT_LCD {
         HAL_LTDC_EnableDither(config.hltdc);
     }
 
-    void ILI9341::drawRectangle(uint32_t x, uint32_t y, uint32_t width, uint32_t height, Pixel color,bool update){
+    void ILI9341::presentFrameBuffer(const FrameBuffer& frameBuffer){
+        setScanoutAddress(frameBuffer.getBufferAddress(), frameBuffer.getWidth());
+        reloadOnVBlank();
+    }
+
+    void ILI9341::setScanoutAddress(const void* address,uint32_t pitch){
+        LTDC_Layer_TypeDef* const layer = LTDC_LAYER(config.hltdc, 0);
+
+        // The HAL setters rewrite every layer register under the handle lock; a swap needs two.
+        layer->CFBAR = reinterpret_cast<uint32_t>(address);
+        layer->CFBLR = ((pitch * sizeof(Pixel)) << 16) | ((LCD_WIDTH * sizeof(Pixel)) + 3);
+
+        // Later HAL calls on layer 0 rebuild the registers from the handle.
+        config.hltdc->LayerCfg[0].FBStartAdress = reinterpret_cast<uint32_t>(address);
+    }
+
+    void ILI9341::reloadOnVBlank(){
+        // HAL_LTDC_Reload without the handle lock, so it cannot fail with HAL_BUSY.
+        __HAL_LTDC_ENABLE_IT(config.hltdc, LTDC_IT_RR);
+        config.hltdc->Instance->SRCR = LTDC_SRCR_VBR;
+    }
+
+    Dma2dQueue::Fence ILI9341::drawRectangleAsync(uint32_t x, uint32_t y, uint32_t width, uint32_t height, Pixel color,bool update){
+        ASSERT_PARAM(config.hdma2d != nullptr);
+
+        const Rect area{x, y, width, height};
+        const Dma2dQueue::Fence fence = _dma2dQueue.fill(getDrawingFrameBuffer(), area, color);
+
+        markDamaged(area);
+        finishDrawing(update);
+
+        return fence;
+    }
+
+    Dma2dQueue::Fence ILI9341::copyRectAsync(const FrameBuffer& source,const Rect& area,uint32_t x,uint32_t y,bool update){
+        ASSERT_PARAM(config.hdma2d != nullptr);
+
+        const Dma2dQueue::Fence fence = _dma2dQueue.copy(source, area, getDrawingFrameBuffer(), x, y);
+
+        markDamaged(Rect{x, y, area.width, area.height});
+        finishDrawing(update);
+
+        return fence;
+    }
+
+    Dma2dQueue::Fence ILI9341::drawImageAsync(const void* pixels,uint32_t pitch,uint32_t inputColorMode,const Rect& area,bool update){
+        ASSERT_PARAM(config.hdma2d != nullptr);
+
+        const Dma2dQueue::Fence fence = _dma2dQueue.convert(pixels, pitch, inputColorMode, getDrawingFrameBuffer(), area);
+
+        markDamaged(area);
+        finishDrawing(update);
+
+        return fence;
+    }
+
+    Dma2dQueue::Fence ILI9341::blendRectAsync(const FrameBuffer& source,const Rect& area,uint8_t alpha,uint32_t x,uint32_t y,bool update){
+        ASSERT_PARAM(config.hdma2d != nullptr);
+
+        const Dma2dQueue::Fence fence = _dma2dQueue.blend(source, area, alpha, getDrawingFrameBuffer(), x, y);
+
+        markDamaged(Rect{x, y, area.width, area.height});
+        finishDrawing(update);
+
+        return fence;
+    }
+
+    void ILI9341::setLowResolution(uint16_t* FrameBufferAddress){
+        const bool wasLowResolution = _isLowResolution;
+
+        _isLowResolution = (FrameBufferAddress != nullptr);
+
+        if(_isLowResolution == true){
+            _lowRes = FrameBuffer(FrameBufferAddress,LOW_RES_WIDTH,LOW_RES_HEIGHT);
+            return;
+        }
+
+        // Low-resolution presents skip the copy-back; bring the back buffer up to date once.
+        if(wasLowResolution == true && _hasBackFrame == true && _frameQueue.isAttached() == false){
+            _dma2dQueue.waitIdle();
+            waitForPresent();
+
+            _FrameBuffer[!_selectedFrameBuffer].copyRect(_FrameBuffer[_selectedFrameBuffer], Rect{0, 0, LCD_WIDTH, LCD_HEIGHT}, config.hdma2d);
+            _damage.clear();
+        }
+    }
+
+    void ILI9341::presentLowResolution(const DisplayList* overlay,bool update){
+        ASSERT_PARAM(_isLowResolution == true);
+
+        FrameBuffer& target = beginDrawing(Rect{0, 0, LCD_WIDTH, LCD_HEIGHT});
+
+        ASSERT_PARAM(2 * _lowRes.getWidth() <= target.getWidth() && 2 * _lowRes.getHeight() <= target.getHeight());
+
+        target.upscale2x(_lowRes);
+
+        if(overlay != nullptr){
+            overlay->replay(target);
+        }
+
+        if(_frameQueue.isAttached() == true){
+            // The other queued buffers refresh from the damage list.
+            markDamaged(Rect{0, 0, LCD_WIDTH, LCD_HEIGHT});
+        }
+        else{
+            // The next upscale overwrites the whole back buffer: skip the copy-back.
+            _damage.clear();
+        }
+
+        finishDrawing(update);
+    }
+
+    void ILI9341::showCanvas(VirtualCanvas& canvas){
+        ASSERT_PARAM(canvas.getPitch() >= LCD_WIDTH);
+        // In queued mode the next vblank would replace the canvas with the queued frame.
+        ASSERT_PARAM(_frameQueue.isAttached() == false);
+
+        // The commit copies with blocking DMA2D; the reload interrupt must not start a copy-back under it.
+        waitForPresent();
+        _dma2dQueue.waitIdle();
+        canvas.commit();
+
+        setScanoutAddress(canvas.getViewAddress(), canvas.getPitch());
+        reloadOnVBlank();
+    }
+
+    void ILI9341::hideCanvas(){
+        // Restores the pitch as well.
+        presentFrameBuffer(_FrameBuffer[_selectedFrameBuffer]);
+    }
+
+    void ILI9341::setOverlay(uint16_t* FrameBufferAddress,uint32_t width,uint32_t height,uint32_t left,uint32_t top){
+        ASSERT_PARAM(width <= LCD_WIDTH && height <= LCD_HEIGHT);
+
+        _overlay = FrameBuffer(FrameBufferAddress,width,height);
+        _overlayLeft = (left + width <= LCD_WIDTH) ? left : (LCD_WIDTH - width);
+        _overlayTop = (top + height <= LCD_HEIGHT) ? top : (LCD_HEIGHT - height);
+        _overlayAlpha = 255;
+        _hasOverlay = true;
+
+        setLayer(1,_overlay,_overlayLeft,_overlayTop);
+    }
+
+    void ILI9341::moveOverlay(uint32_t left,uint32_t top){
+        ASSERT_PARAM(_hasOverlay == true);
+
+        left = (left + _overlay.getWidth() <= LCD_WIDTH) ? left : (LCD_WIDTH - _overlay.getWidth());
+        top = (top + _overlay.getHeight() <= LCD_HEIGHT) ? top : (LCD_HEIGHT - _overlay.getHeight());
+
+        if(left == _overlayLeft && top == _overlayTop){
+            return;
+        }
+
+        _overlayLeft = left;
+        _overlayTop = top;
+
+        if(HAL_LTDC_SetWindowPosition_NoReload(config.hltdc, left, top, 1) != HAL_OK){
+            ASSERT_PARAM(false);
+        }
+
+        reloadOnVBlank();
+    }
+
+    void ILI9341::setOverlayAlpha(uint8_t alpha){
+        ASSERT_PARAM(_hasOverlay == true);
+
+        if(alpha == _overlayAlpha){
+            return;
+        }
+
+        _overlayAlpha = alpha;
+
+        if(HAL_LTDC_SetAlpha_NoReload(config.hltdc, alpha, 1) != HAL_OK){
+            ASSERT_PARAM(false);
+        }
+
+        reloadOnVBlank();
+    }
+
+    void ILI9341::setOverlayColorKey(Pixel key){
+        ASSERT_PARAM(_hasOverlay == true);
+
+        // LTDC compares keys after expanding RGB565 to RGB888 by repeating the high bits.
+        const uint32_t red = (key.color.red << 3) | (key.color.red >> 2);
+        const uint32_t green = (key.color.green << 2) | (key.color.green >> 4);
+        const uint32_t blue = (key.color.blue << 3) | (key.color.blue >> 2);
+
+        if(HAL_LTDC_ConfigColorKeying_NoReload(config.hltdc, (red << 16) | (green << 8) | blue, 1) != HAL_OK){
+            ASSERT_PARAM(false);
+        }
+
+        if(HAL_LTDC_EnableColorKeying_NoReload(config.hltdc, 1) != HAL_OK){
+            ASSERT_PARAM(false);
+        }
+
+        _isOverlayColorKeyed = true;
+        _overlayColorKey = key;
+
+        reloadOnVBlank();
+    }
+
+    void ILI9341::disableOverlayColorKey(){
+        ASSERT_PARAM(_hasOverlay == true);
+
+        if(HAL_LTDC_DisableColorKeying_NoReload(config.hltdc, 1) != HAL_OK){
+            ASSERT_PARAM(false);
+        }
+
+        _isOverlayColorKeyed = false;
+
+        reloadOnVBlank();
+    }
+
+    void ILI9341::setOverlayVisible(bool visible){
+        ASSERT_PARAM(_hasOverlay == true);
+
+        if(visible == true){
+            __HAL_LTDC_LAYER_ENABLE(config.hltdc, 1);
+        }
+        else{
+            __HAL_LTDC_LAYER_DISABLE(config.hltdc, 1);
+        }
+
+        reloadOnVBlank();
+    }
+
+    void ILI9341::restoreOverlay(){
+        if(_hasOverlay == false){
+            __HAL_LTDC_LAYER_DISABLE(config.hltdc, 1);
+            reloadOnVBlank();
+            return;
+        }
+
+        setLayer(1,_overlay,_overlayLeft,_overlayTop,_overlayAlpha);
+
+        if(_isOverlayColorKeyed == true){
+            setOverlayColorKey(_overlayColorKey);
+        }
+    }
+
+    bool ILI9341::isLayerTransition(TransitionEffect effect){
+        return effect != CROSS_FADE_DMA2D && effect != WIPE_RIGHT && effect != WIPE_DOWN;
+    }
+
+    void ILI9341::setTransitionWindow(uint32_t left,uint32_t top,uint32_t width,uint32_t height,const Pixel* source){
+        if(HAL_LTDC_SetWindowSize_NoReload(config.hltdc, width, height, 1) != HAL_OK){
+            ASSERT_PARAM(false);
+        }
+
+        if(HAL_LTDC_SetWindowPosition_NoReload(config.hltdc, left, top, 1) != HAL_OK){
+            ASSERT_PARAM(false);
+        }
+
+        if(HAL_LTDC_SetAddress_NoReload(config.hltdc, reinterpret_cast<uint32_t>(source), 1) != HAL_OK){
+            ASSERT_PARAM(false);
+        }
+
+        if(HAL_LTDC_SetAlpha_NoReload(config.hltdc, 255, 1) != HAL_OK){
+            ASSERT_PARAM(false);
+        }
+
+        // The calls above rewrite the pitch from the window width, so the pitch goes last.
+        if(HAL_LTDC_SetPitch_NoReload(config.hltdc, LCD_WIDTH, 1) != HAL_OK){
+            ASSERT_PARAM(false);
+        }
+
+        reloadOnVBlank();
+    }
+
+    void ILI9341::startTransition(const FrameBuffer& from,const FrameBuffer& to,TransitionEffect effect,uint32_t frames){
+        ASSERT_PARAM(to.getWidth() == LCD_WIDTH && to.getHeight() == LCD_HEIGHT);
+
+        if(effect == CROSS_FADE_DMA2D && config.hdma2d == nullptr){
+            effect = CROSS_FADE;
+        }
+
+        _transitionFrom = &from;
+        _transitionTo = &to;
+        _transitionEffect = effect;
+        _transitionFrames = (frames != 0) ? frames : 1;
+        _transitionStep = 0;
+
+        if(isLayerTransition(effect) == true){
+            // A key would punch holes into the new surface; the configuration reloads immediately.
+            if(HAL_LTDC_DisableColorKeying_NoReload(config.hltdc, 1) != HAL_OK){
+                ASSERT_PARAM(false);
+            }
+
+            setLayer(1,to,0,0,0);
+        }
+    }
+
+    bool ILI9341::stepTransition(){
+        if(_transitionFrames == 0){
+            return false;
+        }
+
+        _transitionStep++;
+
+        // Layer effects finish one frame late, once the last step is on screen.
+        if(_transitionStep > _transitionFrames){
+            finishTransition();
+            return false;
+        }
+
+        const FrameBuffer& to = *_transitionTo;
+        const Pixel* const pixels = static_cast<const Pixel*>(to.getBufferAddress());
+        const uint32_t step = _transitionStep;
+        const uint32_t frames = _transitionFrames;
+        const uint8_t alpha = static_cast<uint8_t>((255 * step) / frames);
+        const uint32_t columns = std::max<uint32_t>((LCD_WIDTH * step) / frames, 1);
+        const uint32_t rows = std::max<uint32_t>((LCD_HEIGHT * step) / frames, 1);
+
+        switch(_transitionEffect){
+        case CROSS_FADE:
+            if(HAL_LTDC_SetAlpha_NoReload(config.hltdc, alpha, 1) != HAL_OK){
+                ASSERT_PARAM(false);
+            }
+
+            reloadOnVBlank();
+            break;
+        case SLIDE_LEFT:
+            setTransitionWindow(LCD_WIDTH - columns, 0, columns, LCD_HEIGHT, pixels);
+            break;
+        case SLIDE_RIGHT:
+            setTransitionWindow(0, 0, columns, LCD_HEIGHT, &pixels[LCD_WIDTH - columns]);
+            break;
+        case SLIDE_UP:
+            setTransitionWindow(0, LCD_HEIGHT - rows, LCD_WIDTH, rows, pixels);
+            break;
+        case SLIDE_DOWN:
+            setTransitionWindow(0, 0, LCD_WIDTH, rows, &pixels[(LCD_HEIGHT - rows) * LCD_WIDTH]);
+            break;
+        case CROSS_FADE_DMA2D:
+            {
+                FrameBuffer& target = beginDrawing(Rect{0, 0, LCD_WIDTH, LCD_HEIGHT});
+
+                Dma2dEngine(config.hdma2d).blend(
+                        pixels, LCD_WIDTH,
+                        static_cast<const Pixel*>(_transitionFrom->getBufferAddress()), LCD_WIDTH,
+                        alpha, &target.at(0, 0), LCD_WIDTH, LCD_WIDTH, LCD_HEIGHT);
+                markDamaged(Rect{0, 0, LCD_WIDTH, LCD_HEIGHT});
+                finishDrawing(true);
+            }
+            break;
+        case WIPE_RIGHT:
+            {
+                const uint32_t left = (LCD_WIDTH * (step - 1)) / frames;
+                const Rect strip{left, 0, ((LCD_WIDTH * step) / frames) - left, LCD_HEIGHT};
+
+                beginDrawing(strip).copyRect(to, strip, config.hdma2d);
+                markDamaged(strip);
+                finishDrawing(true);
+            }
+            break;
+        case WIPE_DOWN:
+            {
+                const uint32_t top = (LCD_HEIGHT * (step - 1)) / frames;
+                const Rect strip{0, top, LCD_WIDTH, ((LCD_HEIGHT * step) / frames) - top};
+
+                beginDrawing(strip).copyRect(to, strip, config.hdma2d);
+                markDamaged(strip);
+                finishDrawing(true);
+            }
+            break;
+        }
+
+        if(_transitionStep == _transitionFrames && isLayerTransition(_transitionEffect) == false){
+            finishTransition();
+            return false;
+        }
+
+        return true;
+    }
+
+    void ILI9341::finishTransition(){
+        if(isLayerTransition(_transitionEffect) == true){
+            // Layer 1 covers layer 0 completely, so its buffers can be updated unseen.
+            // The copies use blocking DMA2D on the driver's handle: drain its other users first.
+            waitForPresent();
+            _dma2dQueue.waitIdle();
+
+            for(uint32_t idx = 0; idx < FRAME_BUFFER_COUNT; idx++){
+                if(_FrameBuffer[idx].getBufferAddress() != nullptr){
+                    _FrameBuffer[idx].copyRect(*_transitionTo, Rect{0, 0, LCD_WIDTH, LCD_HEIGHT}, config.hdma2d);
+                }
+            }
+
+            restoreOverlay();
+        }
+
+        _transitionFrom = nullptr;
+        _transitionTo = nullptr;
+        _transitionFrames = 0;
+        _transitionStep = 0;
+    }
+
+    void ILI9341::runTransition(const FrameBuffer& from,const FrameBuffer& to,TransitionEffect effect,uint32_t frames){
+        startTransition(from, to, effect, frames);
+
+        // Blocking and asynchronous double-buffered presents already advance one vblank per step.
+        const bool isPresentPaced = isLayerTransition(_transitionEffect) == false
+                && _hasBackFrame == true && _frameQueue.isAttached() == false;
+
+        do{
+            if(isPresentPaced == false){
+                waitForVBlank();
+            }
+        } while(stepTransition() == true);
+    }
+
+    bool ILI9341::isReloadPending() const {
+        return (config.hltdc->Instance->SRCR & LTDC_SRCR_VBR) != 0;
+    }
+
+    bool ILI9341::isInVBlank() const {
+        const uint32_t line = config.hltdc->Instance->CPSR & LTDC_CPSR_CYPOS;
+
+        return line <= config.hltdc->Init.AccumulatedVBP || line > config.hltdc->Init.AccumulatedActiveH;
+    }
+
+    uint32_t ILI9341::getVBlankLine() const {
+        return config.hltdc->Init.AccumulatedActiveH + 1;
+    }
+
+    void ILI9341::programLineEvent(uint32_t line){
+        // HAL_LTDC_ProgramLineEvent without the handle lock, so the vblank interrupt can always re-arm.
+        __HAL_LTDC_DISABLE_IT(config.hltdc, LTDC_IT_LI);
+        _lineEventLine = line;
+        config.hltdc->Instance->LIPCR = line;
+        __HAL_LTDC_ENABLE_IT(config.hltdc, LTDC_IT_LI);
+    }
+
+    void ILI9341::waitForScanOutside(uint32_t top, uint32_t height){
+        const LTDC_InitTypeDef& timing = config.hltdc->Init;
+        const uint32_t firstActive = timing.AccumulatedVBP + 1;
+        const uint32_t bottom = (top + height < LCD_HEIGHT) ? (top + height) : LCD_HEIGHT;
+        const uint32_t start = HAL_GetTick();
+        bool hasWaited = false;
+
+        // The beam leaves any band within a frame; the timeout covers a stopped LTDC.
+        while(HAL_GetTick() - start < BEAM_WAIT_TIMEOUT){
+            const uint32_t position = config.hltdc->Instance->CPSR & LTDC_CPSR_CYPOS;
+            uint32_t linesBefore = 0;    // lines until the beam reaches `top`
+
+            if(position > timing.AccumulatedActiveH){
+                linesBefore = (timing.TotalHeigh + 1 - position) + firstActive + top;
+            }
+            else if(position < firstActive){
+                linesBefore = (firstActive - position) + top;
+            }
+            else{
+                const uint32_t row = position - firstActive;
+
+                // Already past the band: a whole frame until the beam is back.
+                if(row >= bottom){
+                    break;
+                }
+
+                linesBefore = (row < top) ? (top - row) : 0;
+            }
+
+            if(linesBefore > _beamMarginLines){
+                break;
+            }
+
+            if(hasWaited == false){
+                hasWaited = true;
+                _beamWaitCount++;
+
+#ifdef USE_FREERTOS
+                // The line event is shared with waitForVBlank.
+                xSemaphoreTake(_lineEventMutex, portMAX_DELAY);
+#endif
+            }
+
+#ifdef USE_FREERTOS
+            // Sleep until the beam leaves the band; the tick timeout covers a missing callback.
+            xSemaphoreTake(_lineEventSemaphore, 0);
+            programLineEvent(firstActive + bottom);
+            xSemaphoreTake(_lineEventSemaphore, 1);
+#endif
+        }
+
+#ifdef USE_FREERTOS
+        if(hasWaited == true){
+            // Leave the line event on the vblank line for other waiters.
+            xSemaphoreTake(_lineEventSemaphore, 0);
+            programLineEvent(getVBlankLine());
+            xSemaphoreGive(_lineEventMutex);
+        }
+#endif
+    }
+
+    void ILI9341::waitForReload(){
+        while(isReloadPending() == true){
+#ifdef USE_FREERTOS
+            // Woken by onReloadEvent; the one-tick timeout covers a missing callback.
+            xSemaphoreTake(_reloadSemaphore, 1);
+#endif
+        }
+    }
+
+    bool ILI9341::startNextCopyBack(){
+        FrameBuffer& front = _FrameBuffer[_selectedFrameBuffer];
+        FrameBuffer& back = _FrameBuffer[!_selectedFrameBuffer];
+
+        // A transfer that does not start raises no interrupt; skip it so the present still ends.
+        while(_copyBackIndex < _copyBack.getCount()){
+            const Rect& area = _copyBack.getRect(_copyBackIndex++);
+
+            if(Dma2dEngine(config.hdma2d).startCopy(
+                    &front.at(area.x, area.y), front.getWidth(),
+                    &back.at(area.x, area.y), back.getWidth(),
+                    area.width, area.height) == true){
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void ILI9341::finishPresent(){
+        _presentState = PRESENT_IDLE;
+
+#ifdef USE_FREERTOS
+        BaseType_t isWoken = pdFALSE;
+
+        xSemaphoreGiveFromISR(_presentSemaphore, &isWoken);
+        portYIELD_FROM_ISR(isWoken);
+#endif
+    }
+
+    FrameBuffer& ILI9341::getDrawingFrameBuffer(){
+        waitForPresent();
+
+        if(_frameQueue.isAttached() == true){
+            return _frameQueue.getRenderBuffer();
+        }
+
         uint32_t curFrameBufferIdx = _selectedFrameBuffer;
 
         if(_hasBackFrame == true){
             curFrameBufferIdx = !curFrameBufferIdx;
         }
 
-        _FrameBuffer[curFrameBufferIdx].drawRectangle(x, y, width, height, color);
-        _isUpdatedRecently = false;
+        return _FrameBuffer[curFrameBufferIdx];
+    }
 
-        if(_hasBackFrame == true && update == true){
-            updateFrame();
+    bool ILI9341::submitQueuedFrame(){
+        _frameQueue.submit(_damage, HAL_GetTick());
+        _damage.clear();
+
+        const uint32_t start = HAL_GetTick();
+
+        while(_frameQueue.tryAcquire() == false){
+            // No vblank for several frames: re-arm the line event and draw over
+            // the frame that never reached the screen instead of blocking.
+            if(HAL_GetTick() - start >= FRAME_QUEUE_TIMEOUT && _frameQueue.reclaimQueued() == true){
+                programLineEvent(getVBlankLine());
+                _frameQueue.addStallTime(HAL_GetTick() - start);
+                return false;
+            }
+
+#ifdef USE_FREERTOS
+            // Every buffer is shown or queued: a buffer frees up at the next vblank.
+            xSemaphoreTake(_lineEventSemaphore, 1);
+#endif
         }
+
+        _frameQueue.addStallTime(HAL_GetTick() - start);
+        _frameQueue.refreshRenderBuffer(config.hdma2d);
+
+        return true;
     }
 
-    void ILI9341::putText(std::string text, uint32_t x,uint32_t y,const sFONT& font,Pixel color,bool update){
-        uint32_t curFrameBufferIdx = _selectedFrameBuffer;
+    FrameBuffer& ILI9341::beginDrawing(const Rect& area){
+        FrameBuffer& target = getDrawingFrameBuffer();
+
+        // Only DMA2D jobs on these pixels have to finish before the CPU draws.
+        _dma2dQueue.waitForArea(target, area);
+
+        if(_isBeamRacing == true && _hasBackFrame == false){
+            waitForScanOutside(area.y, area.height);
+        }
+
+        return target;
+    }
 
+    void ILI9341::markDamaged(const Rect& area){
         if(_hasBackFrame == true){
-            curFrameBufferIdx = !curFrameBufferIdx;
+            _damage.add(area);
         }
+    }
 
-        _FrameBuffer[curFrameBufferIdx].putText(text, x, y, font, color);
+    void ILI9341::finishDrawing(bool update){
         _isUpdatedRecently = false;
 
-        if(_hasBackFrame == true && update == true){
+        if(_hasBackFrame == true && update == true && _frameDepth == 0){
             updateFrame();
         }
     }
 
+    void ILI9341::drawRectangle(uint32_t x, uint32_t y, uint32_t width, uint32_t height, Pixel color,bool update){
+        const Rect area{x, y, width, height};
+
+        beginDrawing(area).drawRectangle(x, y, width, height, color);
+        markDamaged(area);
+        finishDrawing(update);
+    }
+
+    void ILI9341::putText(std::string_view text, uint32_t x,uint32_t y,const sFONT& font,Pixel color,bool update){
+        const Rect area{x, y, FrameBuffer::measureText(text, font), font.Height};
+
+        beginDrawing(area).putText(text, x, y, font, color);
+        markDamaged(area);
+        finishDrawing(update);
+    }
+
     void ILI9341::putChar(uint8_t character,uint32_t x,uint32_t y,const sFONT& font,Pixel color,bool update){
-        uint32_t curFrameBufferIdx = _selectedFrameBuffer;
+        const Rect area{x, y, font.Width, font.Height};
 
-        if(_hasBackFrame == true){
-            curFrameBufferIdx = !curFrameBufferIdx;
+        beginDrawing(area).putChar(character, x, y, font, color);
+        markDamaged(area);
+        finishDrawing(update);
+    }
+
+    void ILI9341::putTextScaled(std::string_view text, uint32_t x,uint32_t y,const sFONT& font,Pixel color,uint32_t scale,bool update){
+        const Rect area{x, y, FrameBuffer::measureText(text, font) * scale, font.Height * scale};
+
+        beginDrawing(area).putTextScaled(text, x, y, font, color, scale);
+        markDamaged(area);
+        finishDrawing(update);
+    }
+
+    void ILI9341::putCharScaled(uint8_t character,uint32_t x,uint32_t y,const sFONT& font,Pixel color,uint32_t scale,bool update){
+        const Rect area{x, y, font.Width * scale, font.Height * scale};
+
+        beginDrawing(area).putCharScaled(character, x, y, font, color, scale);
+        markDamaged(area);
+        finishDrawing(update);
+    }
+
+    void ILI9341::putNumber(int32_t value, uint32_t x,uint32_t y,const sFONT& font,Pixel color,NumberFormat format,bool update){
+        const Rect area{x, y, FrameBuffer::getNumberLength(value, format) * font.Width, font.Height};
+
+        beginDrawing(area).putNumber(value, x, y, font, color, format);
+        markDamaged(area);
+        finishDrawing(update);
+    }
+
+    void ILI9341::putNumber(int32_t value, uint32_t x,uint32_t y,const CompactFont& font,Pixel color,NumberFormat format,bool update){
+        const Rect area{x, y, FrameBuffer::getNumberLength(value, format) * font.cellWidth, font.cellHeight};
+
+        beginDrawing(area).putNumber(value, x, y, font, color, format);
+        markDamaged(area);
+        finishDrawing(update);
+    }
+
+    void ILI9341::putText(const TextLayout& layout,Pixel color,bool update){
+        const Rect bounds = layout.getBounds();
+
+        layout.draw(beginDrawing(bounds), color);
+        markDamaged(bounds);
+        finishDrawing(update);
+    }
+
+    void ILI9341::putText(TextLabel& label,std::string_view text,bool update){
+        const Rect area = label.getUpdateArea();
+        const uint32_t changedCount = label.update(beginDrawing(area), text);
+
+        for(uint32_t idx = 0; idx < changedCount; idx++){
+            markDamaged(label.getChangedRect(idx));
         }
 
-        _FrameBuffer[curFrameBufferIdx].putChar(character, x, y, font, color);
-        _isUpdatedRecently = false;
-        
-        if(_hasBackFrame == true && update == true){
-            updateFrame();
+        finishDrawing(update);
+    }
+
+    void ILI9341::drawDisplayList(const DisplayList& list,bool update){
+        // Hold presents back while replaying; the commands only accumulate damage.
+        _frameDepth++;
+        list.replay(*this);
+        _frameDepth--;
+
+        finishDrawing(update);
+    }
+
+    void ILI9341::drawDisplayList(const DisplayList& list,TileRenderer& renderer,bool update){
+        const Rect area = renderer.render(list, beginDrawing(Rect{0, 0, LCD_WIDTH, LCD_HEIGHT}));
+        markDamaged(area);
+        finishDrawing(update);
+    }
+
+    void ILI9341::putText(std::string_view text, uint32_t x,uint32_t y,const sFONT& font,Pixel color,Pixel background,GlyphCache& cache,bool update){
+        const Rect area{x, y, FrameBuffer::measureText(text, font), font.Height};
+
+        cache.putText(beginDrawing(area), text, x, y, font, color, background);
+        markDamaged(area);
+        finishDrawing(update);
+    }
+
+    void ILI9341::putChar(uint8_t character,uint32_t x,uint32_t y,const sFONT& font,Pixel color,Pixel background,GlyphCache& cache,bool update){
+        const Rect area{x, y, font.Width, font.Height};
+
+        cache.putChar(beginDrawing(area), character, x, y, font, color, background);
+        markDamaged(area);
+        finishDrawing(update);
+    }
+
+    void ILI9341::putText(std::string_view text, uint32_t x,uint32_t y,const ProportionalFont& font,Pixel color,bool update){
+        // Bearings and kerning can reach outside the pen advance: use the whole row band.
+        const Rect band{0, y, LCD_WIDTH, font.height};
+
+        beginDrawing(band).putText(text, x, y, font, color);
+        markDamaged(band);
+        finishDrawing(update);
+    }
+
+    void ILI9341::putChar(uint32_t codepoint,uint32_t x,uint32_t y,const ProportionalFont& font,Pixel color,bool update){
+        const Rect band{0, y, LCD_WIDTH, font.height};
+
+        beginDrawing(band).putChar(codepoint, x, y, font, color);
+        markDamaged(band);
+        finishDrawing(update);
+    }
+
+    void ILI9341::putText(std::string_view text, uint32_t x,uint32_t y,const AntiAliasedFont& font,Pixel color,bool update){
+        const Rect band{0, y, LCD_WIDTH, font.layout.height};
+
+        beginDrawing(band).putText(text, x, y, font, color, config.hdma2d);
+        markDamaged(band);
+        finishDrawing(update);
+    }
+
+    void ILI9341::putChar(uint32_t codepoint,uint32_t x,uint32_t y,const AntiAliasedFont& font,Pixel color,bool update){
+        const Rect band{0, y, LCD_WIDTH, font.layout.height};
+
+        beginDrawing(band).putChar(codepoint, x, y, font, color, config.hdma2d);
+        markDamaged(band);
+        finishDrawing(update);
+    }
+
+    void ILI9341::putText(std::string_view text, uint32_t x,uint32_t y,const CompactFont& font,Pixel color,bool update){
+        const Rect area{x, y, FrameBuffer::measureText(text, font), font.cellHeight};
+
+        beginDrawing(area).putText(text, x, y, font, color);
+        markDamaged(area);
+        finishDrawing(update);
+    }
+
+    void ILI9341::putChar(uint32_t codepoint,uint32_t x,uint32_t y,const CompactFont& font,Pixel color,bool update){
+        const Rect area{x, y, font.cellWidth, font.cellHeight};
+
+        beginDrawing(area).putChar(codepoint, x, y, font, color);
+        markDamaged(area);
+        finishDrawing(update);
+    }
+
+    void ILI9341::beginFrame(){
+        _frameDepth++;
+    }
+
+    bool ILI9341::endFrame(){
+        if(_frameDepth == 0){
+            return false;
+        }
+
+        _frameDepth--;
+
+        if(_frameDepth > 0){
+            return false;
         }
+
+        return updateFrame();
     }
 
     bool ILI9341::updateFrame(){
@@ -431,14 +1193,200 @@ namespace TFT_LCD {
         if(_isUpdatedRecently == true){
             return false;
         }
-        
+
+        _dma2dQueue.waitIdle();
+        waitForPresent();
+
+        if(_frameQueue.isAttached() == true){
+            _isUpdatedRecently = true;
+
+            return submitQueuedFrame();
+        }
+
         _selectedFrameBuffer = !_selectedFrameBuffer;
 
-        setLayer(0, _FrameBuffer[_selectedFrameBuffer]);
+        if(_isAsyncPresent == true && config.hdma2d != nullptr){
+            _copyBack = _damage;
+            _copyBackIndex = 0;
+            _damage.clear();
+
+            // onReloadEvent starts the copy-back once the old buffer is off screen.
+            _presentState = PRESENT_WAITING_RELOAD;
+            presentFrameBuffer(_FrameBuffer[_selectedFrameBuffer]);
+
+            _isUpdatedRecently = true;
+            return true;
+        }
+
+        presentFrameBuffer(_FrameBuffer[_selectedFrameBuffer]);
+
+        // The old front buffer is scanned out until the reload: do not touch it before.
+        waitForReload();
+
+        const FrameBuffer& front = _FrameBuffer[_selectedFrameBuffer];
+        FrameBuffer& back = _FrameBuffer[!_selectedFrameBuffer];
+
+        for(uint32_t idx = 0; idx < _damage.getCount(); idx++){
+            back.copyRect(front, _damage.getRect(idx), config.hdma2d);
+        }
 
-        _FrameBuffer[!_selectedFrameBuffer].copyBuffer(_FrameBuffer[_selectedFrameBuffer],config.hdma2d);
+        _damage.clear();
         _isUpdatedRecently = true;
 
         return true;
     }
+
+    void ILI9341::setAsyncPresent(bool enable){
+        waitForPresent();
+        _isAsyncPresent = enable;
+    }
+
+    void ILI9341::waitForPresent(){
+        while(_presentState != PRESENT_IDLE){
+#ifdef USE_FREERTOS
+            xSemaphoreTake(_presentSemaphore, 1);
+#endif
+        }
+    }
+
+    void ILI9341::setBeamRacing(bool enable, uint32_t marginLines){
+        _isBeamRacing = enable;
+        _beamMarginLines = marginLines;
+        _beamWaitCount = 0;
+    }
+
+    bool ILI9341::waitForVBlank(uint32_t timeout){
+#ifdef USE_FREERTOS
+        // Beam racing reprograms the same line event; wait until it is done.
+        if(xSemaphoreTake(_lineEventMutex, pdMS_TO_TICKS(timeout)) != pdTRUE){
+            return false;
+        }
+
+        // Drop a stale event so the wait starts at the next blanking period.
+        xSemaphoreTake(_lineEventSemaphore, 0);
+        programLineEvent(getVBlankLine());
+
+        const bool isReached = xSemaphoreTake(_lineEventSemaphore, pdMS_TO_TICKS(timeout)) == pdTRUE;
+
+        xSemaphoreGive(_lineEventMutex);
+
+        return isReached;
+#else
+        const uint32_t start = HAL_GetTick();
+
+        // Skip the rest of a blanking period that is already running.
+        while(isInVBlank() == true){
+            if(HAL_GetTick() - start >= timeout){
+                return false;
+            }
+        }
+
+        while(isInVBlank() == false){
+            if(HAL_GetTick() - start >= timeout){
+                return false;
+            }
+        }
+
+        return true;
+#endif
+    }
+
+    void ILI9341::onReloadEvent(){
+        if(_presentState == PRESENT_WAITING_RELOAD){
+            _presentState = PRESENT_COPYING;
+
+            if(startNextCopyBack() == false){
+                finishPresent();
+            }
+        }
+
+#ifdef USE_FREERTOS
+        if(_reloadSemaphore != nullptr){
+            BaseType_t isWoken = pdFALSE;
+
+            xSemaphoreGiveFromISR(_reloadSemaphore, &isWoken);
+            portYIELD_FROM_ISR(isWoken);
+        }
+#endif
+    }
+
+    void ILI9341::onLineEvent(){
+        const bool isVBlank = (_lineEventLine == getVBlankLine());
+
+        if(isVBlank == true){
+            _vblankCount = _vblankCount + 1;
+        }
+
+        if(isVBlank == true && _frameQueue.isAttached() == true){
+            const FrameBuffer* queued = _frameQueue.peekQueued();
+
+            if(queued != nullptr){
+                // Registers only: a task may hold the HAL lock. Already in vertical
+                // blanking, so an immediate reload does not tear; a vblank reload
+                // requested now would only latch a frame later.
+                setScanoutAddress(queued->getBufferAddress(), queued->getWidth());
+                config.hltdc->Instance->SRCR = LTDC_SRCR_IMR;
+
+                // The old buffer may go to the render task only once the new one is programmed.
+                _frameQueue.takeQueued();
+            }
+
+            programLineEvent(getVBlankLine());
+        }
+
+#ifdef USE_FREERTOS
+        if(_lineEventSemaphore != nullptr){
+            BaseType_t isWoken = pdFALSE;
+
+            xSemaphoreGiveFromISR(_lineEventSemaphore, &isWoken);
+            portYIELD_FROM_ISR(isWoken);
+        }
+#endif
+    }
+
+    void ILI9341::onDma2dTransferComplete(){
+        if(_presentState != PRESENT_COPYING){
+            _dma2dQueue.onTransferComplete();
+        }
+        else if(startNextCopyBack() == false){
+            finishPresent();
+        }
+
+#ifdef USE_FREERTOS
+        if(_dma2dSemaphore != nullptr){
+            BaseType_t isWoken = pdFALSE;
+
+            xSemaphoreGiveFromISR(_dma2dSemaphore, &isWoken);
+            portYIELD_FROM_ISR(isWoken);
+        }
+#endif
+    }
+
+    void ILI9341::onDma2dTransferError(){
+        if(_presentState != PRESENT_COPYING){
+            _dma2dQueue.onTransferError();
+        }
+        // A failed copy-back leaves stale rows in the back buffer; keep going so the present ends.
+        else if(startNextCopyBack() == false){
+            finishPresent();
+        }
+
+#ifdef USE_FREERTOS
+        if(_dma2dSemaphore != nullptr){
+            BaseType_t isWoken = pdFALSE;
+
+            xSemaphoreGiveFromISR(_dma2dSemaphore, &isWoken);
+            portYIELD_FROM_ISR(isWoken);
+        }
+#endif
+    }
+
+#ifdef USE_FREERTOS
+    void ILI9341::waitForDma2d(void* context){
+        ILI9341* lcd = static_cast<ILI9341*>(context);
+
+        // Short timeout: a job can also complete between the check and this call.
+        xSemaphoreTake(lcd->_dma2dSemaphore, 1);
+    }
+#endif
 }
@@ -0,0 +1,141 @@
+#include "TextLabel.hpp"
+#include "Utf8Reader.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace TFT_LCD {
+    TextLabel::TextLabel(uint32_t x, uint32_t y, const sFONT& font, Pixel color, Pixel background)
+        : _x{x}, _y{y}, _font{&font}, _color{color}, _background{background}
+    {
+    }
+
+    void TextLabel::addChangedRect(const Rect& rect){
+        if(_changedCount < MAX_CHANGED_RECTS){
+            _changedRects[_changedCount++] = rect;
+            return;
+        }
+
+        // List is full: grow the last rectangle so the report stays conservative.
+        Rect& last = _changedRects[MAX_CHANGED_RECTS - 1];
+        const uint32_t right = std::max(last.x + last.width, rect.x + rect.width);
+        const uint32_t bottom = std::max(last.y + last.height, rect.y + rect.height);
+
+        last.x = std::min(last.x, rect.x);
+        last.y = std::min(last.y, rect.y);
+        last.width = right - last.x;
+        last.height = bottom - last.y;
+    }
+
+    void TextLabel::addChangedCells(uint32_t first, uint32_t count){
+        const uint32_t x = _x + (first * _font->Width);
+
+        if(_changedCount > 0){
+            Rect& last = _changedRects[_changedCount - 1];
+
+            if(last.y == _y && last.height == _font->Height && last.x + last.width == x){
+                last.width += count * _font->Width;
+                return;
+            }
+        }
+
+        addChangedRect(Rect{x, _y, count * _font->Width, _font->Height});
+    }
+
+    uint32_t TextLabel::update(FrameBuffer& target, std::string_view text){
+        _changedCount = 0;
+
+        if(_isMoved == true){
+            // The old cells are not under the new ones: clear them and start empty.
+            if(_paintedArea.width > 0){
+                target.drawRectangle(_paintedArea.x, _paintedArea.y, _paintedArea.width, _paintedArea.height, _background);
+                addChangedRect(_paintedArea);
+            }
+
+            _length = 0;
+            _isMoved = false;
+        }
+
+        uint8_t next[MAX_LENGTH];
+        uint32_t nextLength = 0;
+        Utf8Reader reader(text);
+
+        while(reader.hasNext() && nextLength < MAX_LENGTH){
+            const uint32_t codepoint = reader.next();
+            next[nextLength++] = (codepoint >= ' ' && codepoint <= '~') ? static_cast<uint8_t>(codepoint) : ' ';
+        }
+
+        const uint32_t cellCount = std::max(nextLength, _length);
+        uint32_t runStart = 0;
+        uint32_t runLength = 0;
+
+        for(uint32_t idx = 0; idx < cellCount; idx++){
+            const uint8_t character = (idx < nextLength) ? next[idx] : ' ';
+            const bool isChanged = (_isValid == false) || (idx >= _length) || (_text[idx] != character);
+
+            if(isChanged == true){
+                target.putChar(character, _x + (idx * _font->Width), _y, *_font, _color, _background);
+
+                if(runLength == 0){
+                    runStart = idx;
+                }
+                runLength++;
+            }
+            else if(runLength > 0){
+                addChangedCells(runStart, runLength);
+                runLength = 0;
+            }
+        }
+
+        if(runLength > 0){
+            addChangedCells(runStart, runLength);
+        }
+
+        std::copy(next, next + nextLength, _text);
+        _length = nextLength;
+        _isValid = true;
+
+        _paintedArea = getBounds();
+
+        return _changedCount;
+    }
+
+    Rect TextLabel::getUpdateArea() const {
+        Rect area {_x, _y, MAX_LENGTH * _font->Width, _font->Height};
+
+        if(_paintedArea.width > 0){
+            const uint32_t right = std::max(area.x + area.width, _paintedArea.x + _paintedArea.width);
+            const uint32_t bottom = std::max(area.y + area.height, _paintedArea.y + _paintedArea.height);
+
+            area.x = std::min(area.x, _paintedArea.x);
+            area.y = std::min(area.y, _paintedArea.y);
+            area.width = right - area.x;
+            area.height = bottom - area.y;
+        }
+
+        return area;
+    }
+
+    void TextLabel::setPosition(uint32_t x, uint32_t y){
+        _x = x;
+        _y = y;
+        _isValid = false;
+        _isMoved = true;
+    }
+
+    void TextLabel::setFont(const sFONT& font){
+        _font = &font;
+        _isValid = false;
+        _isMoved = true;
+    }
+
+    void TextLabel::setColors(Pixel color, Pixel background){
+        _color = color;
+        _background = background;
+        _isValid = false;
+    }
+
+    void TextLabel::invalidate(){
+        _isValid = false;
+    }
+}
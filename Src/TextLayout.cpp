@@ -0,0 +1,133 @@
+#include "TextLayout.hpp"
+#include "Utf8Reader.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace TFT_LCD {
+    uint32_t TextLayout::layout(std::string_view text, const sFONT& font, Rect box, Alignment alignment){
+        _text = text;
+        _font = &font;
+        _runCount = 0;
+        _isTruncated = false;
+
+        const uint32_t maxColumns = box.width / font.Width;
+        const uint32_t maxLines = box.height / font.Height;
+
+        size_t position = 0;
+
+        while(position < text.size()){
+            if(_runCount == maxLines || _runCount == MAX_RUNS || maxColumns == 0){
+                _isTruncated = true;
+                break;
+            }
+
+            Utf8Reader reader(text.substr(position));
+
+            size_t lineEnd = 0;         // end of the last complete word, relative
+            uint32_t lineColumns = 0;
+            size_t next = 0;            // where the following line starts, relative
+            bool hasWordBreak = false;
+            bool isSoftBreak = false;
+            uint32_t columns = 0;
+
+            while(true){
+                if(reader.hasNext() == false){
+                    lineEnd = reader.getPosition();
+                    lineColumns = columns;
+                    next = lineEnd;
+                    break;
+                }
+
+                const size_t cursor = reader.getPosition();
+                const uint32_t codepoint = reader.next();
+
+                if(codepoint == '\n'){
+                    lineEnd = cursor;
+                    lineColumns = columns;
+                    next = reader.getPosition();
+                    break;
+                }
+
+                if(codepoint == ' '){
+                    lineEnd = cursor;
+                    lineColumns = columns;
+                    hasWordBreak = true;
+                }
+
+                if(columns == maxColumns){
+                    // Break after the last word, or inside the word if it fills the line.
+                    if(hasWordBreak == false){
+                        lineEnd = cursor;
+                        lineColumns = columns;
+                    }
+
+                    next = lineEnd;
+                    isSoftBreak = true;
+                    break;
+                }
+
+                columns++;
+            }
+
+            while(lineEnd > 0 && text[position + lineEnd - 1] == ' '){
+                lineEnd--;
+                lineColumns--;
+            }
+
+            const uint32_t width = lineColumns * font.Width;
+            uint32_t x = box.x;
+
+            if(alignment == CENTER){
+                x += (box.width - width) / 2;
+            }
+            else if(alignment == RIGHT){
+                x += box.width - width;
+            }
+
+            _runs[_runCount] = Run{
+                static_cast<uint16_t>(position),
+                static_cast<uint16_t>(lineEnd),
+                static_cast<uint16_t>(x),
+                static_cast<uint16_t>(box.y + (_runCount * font.Height)),
+                static_cast<uint16_t>(width)
+            };
+            _runCount++;
+
+            position += next;
+
+            if(isSoftBreak == true){
+                while(position < text.size() && text[position] == ' '){
+                    position++;
+                }
+            }
+        }
+
+        return _runCount;
+    }
+
+    Rect TextLayout::getBounds() const {
+        if(_runCount == 0){
+            return Rect{0, 0, 0, 0};
+        }
+
+        uint32_t left = _runs[0].x;
+        uint32_t right = _runs[0].x + _runs[0].width;
+
+        for(uint32_t idx = 1; idx < _runCount; idx++){
+            left = std::min<uint32_t>(left, _runs[idx].x);
+            right = std::max<uint32_t>(right, _runs[idx].x + _runs[idx].width);
+        }
+
+        const uint32_t top = _runs[0].y;
+        const uint32_t bottom = _runs[_runCount - 1].y + _font->Height;
+
+        return Rect{left, top, right - left, bottom - top};
+    }
+
+    void TextLayout::draw(FrameBuffer& target, Pixel color) const {
+        for(uint32_t idx = 0; idx < _runCount; idx++){
+            target.putText(getRunText(idx), _runs[idx].x, _runs[idx].y, *_font, color);
+        }
+    }
+}
@@ -0,0 +1,266 @@
+#include "TileRenderer.hpp"
+#include "Dma2dEngine.hpp"
+#include "Utf8Reader.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace TFT_LCD {
+    static_assert(DisplayList::MAX_COMMANDS <= 64, "Tile bins are 64-bit command masks");
+
+    namespace {
+        /** @brief Intersection of two rectangles; zero size when disjoint. */
+        Rect intersect(const Rect& a, const Rect& b){
+            const uint32_t left = std::max(a.x, b.x);
+            const uint32_t top = std::max(a.y, b.y);
+            const uint32_t right = std::min(a.x + a.width, b.x + b.width);
+            const uint32_t bottom = std::min(a.y + a.height, b.y + b.height);
+
+            if(left >= right || top >= bottom){
+                return Rect{0, 0, 0, 0};
+            }
+
+            return Rect{left, top, right - left, bottom - top};
+        }
+
+        /** @brief Destination area of a command as a `Rect`. */
+        inline Rect boundsOf(const DisplayList::Command& command){
+            return Rect{command.x, command.y, command.width, command.height};
+        }
+    }
+
+    TileRenderer::TileRenderer(uint16_t* arena, uint32_t arenaPixels, uint32_t tileWidth, uint32_t tileHeight, DMA2D_HandleTypeDef* hdma2d)
+        : _arena{reinterpret_cast<Pixel*>(arena)}, _tileWidth{tileWidth}, _tileHeight{tileHeight}, _hdma2d{hdma2d}
+    {
+        if(getArenaPixels(_tileWidth, _tileHeight) > arenaPixels){
+            _tileHeight = (tileWidth == 0) ? 0 : (arenaPixels / tileWidth);
+        }
+
+        _tile.setBuffer(_arena);
+        _tile.setWidth(_tileWidth);
+        _tile.setHeight(_tileHeight);
+    }
+
+    void TileRenderer::transfer(FrameBuffer& target, const Rect& area, bool isFlush){
+        Pixel* const tilePixels = &_tile.at(0, 0);
+        Pixel* const framePixels = &target.at(area.x, area.y);
+        const uint32_t frameWidth = target.getWidth();
+
+        if(_hdma2d != nullptr){
+            if(isFlush == true){
+                Dma2dEngine(_hdma2d).copy(tilePixels, _tileWidth, framePixels, frameWidth, area.width, area.height);
+            }
+            else{
+                Dma2dEngine(_hdma2d).copy(framePixels, frameWidth, tilePixels, _tileWidth, area.width, area.height);
+            }
+            return;
+        }
+
+        for(uint32_t iy = 0; iy < area.height; iy++){
+            Pixel* const tileLine = &tilePixels[iy * _tileWidth];
+            Pixel* const frameLine = &framePixels[iy * frameWidth];
+
+            if(isFlush == true){
+                memcpy(frameLine, tileLine, area.width * sizeof(Pixel));
+            }
+            else{
+                memcpy(tileLine, frameLine, area.width * sizeof(Pixel));
+            }
+        }
+    }
+
+    void TileRenderer::drawCommand(const DisplayList& list, const DisplayList::Command& command, const Rect& area){
+        if(command.kind == DisplayList::FILL_RECT){
+            const Rect clipped = intersect(boundsOf(command), area);
+
+            _tile.drawRectangle(clipped.x - area.x, clipped.y - area.y, clipped.width, clipped.height, command.color);
+            return;
+        }
+
+        const bool isCompact = (command.kind == DisplayList::TEXT_COMPACT);
+        const sFONT* const font = static_cast<const sFONT*>(command.font);
+        const CompactFont* const compactFont = static_cast<const CompactFont*>(command.font);
+        const uint32_t cellWidth = isCompact ? compactFont->cellWidth : font->Width;
+        const uint32_t cellHeight = isCompact ? compactFont->cellHeight : font->Height;
+
+        Utf8Reader reader(list.getText(command));
+
+        for(uint32_t cellX = command.x; reader.hasNext(); cellX += cellWidth){
+            const uint32_t codepoint = reader.next();
+            const Rect clipped = intersect(Rect{cellX, command.y, cellWidth, cellHeight}, area);
+
+            if(clipped.width == 0){
+                continue;
+            }
+
+            if(isCompact == true){
+                drawGlyph(codepoint, cellX, command.y, *compactFont, command.color, area);
+            }
+            else if(codepoint <= 0xFF){
+                drawGlyph(static_cast<uint8_t>(codepoint), cellX, command.y, *font, command.color, area);
+            }
+        }
+    }
+
+    void TileRenderer::drawGlyph(uint8_t character, uint32_t x, uint32_t y, const sFONT& font, Pixel color, const Rect& area){
+        if(character < ' ' || character > '~'){
+            return;
+        }
+
+        const uint32_t widthBytes = ((font.Width - 1) / 8) + 1;
+        const uint8_t* row = &font.table[widthBytes * font.Height * (character - ' ')];
+        const uint32_t widthMask = (font.Width >= 32) ? 0xFFFFFFFF : ~(0xFFFFFFFF >> font.Width);
+        const int32_t left = static_cast<int32_t>(x - area.x);
+        const int32_t top = static_cast<int32_t>(y - area.y);
+
+        for(uint32_t iy = 0; iy < font.Height; iy++, row += widthBytes){
+            uint32_t mask = 0;
+
+            for(uint32_t byteIdx = 0; byteIdx < widthBytes; byteIdx++){
+                mask = (mask << 8) | row[byteIdx];
+            }
+
+            fillClippedRow(top + iy, left, (mask << (32 - (widthBytes * 8))) & widthMask, color, area);
+        }
+    }
+
+    void TileRenderer::drawGlyph(uint32_t codepoint, uint32_t x, uint32_t y, const CompactFont& font, Pixel color, const Rect& area){
+        const int32_t glyphIndex = font.index.find(codepoint);
+
+        if(glyphIndex < 0){
+            return;
+        }
+
+        const CompactGlyph& glyph = font.glyphs[glyphIndex];
+        const uint8_t* data = &font.data[glyph.offset];
+        const int32_t left = static_cast<int32_t>(x + glyph.x - area.x);
+        const int32_t top = static_cast<int32_t>(y + glyph.y - area.y);
+
+        // Rows are not byte aligned: keep unread bits left-aligned in `bits`.
+        uint32_t bits = 0;
+        uint32_t bitCount = 0;
+
+        for(uint32_t iy = 0; iy < glyph.height; iy++){
+            while(bitCount < glyph.width){
+                bits |= static_cast<uint32_t>(*data++) << (24 - bitCount);
+                bitCount += 8;
+            }
+
+            fillClippedRow(top + iy, left, bits & ~(0xFFFFFFFF >> glyph.width), color, area);
+
+            bits <<= glyph.width;
+            bitCount -= glyph.width;
+        }
+    }
+
+    void TileRenderer::fillClippedRow(int32_t row, int32_t left, uint32_t mask, Pixel color, const Rect& area){
+        if(row < 0 || row >= static_cast<int32_t>(area.height)){
+            return;
+        }
+
+        // Mask columns that would land outside the tile.
+        const int32_t first = std::max<int32_t>(-left, 0);
+        const int32_t end = std::min<int32_t>(static_cast<int32_t>(area.width) - left, 32);
+
+        if(first >= end){
+            return;
+        }
+
+        mask &= 0xFFFFFFFF >> first;
+
+        if(end < 32){
+            mask &= ~(0xFFFFFFFF >> end);
+        }
+
+        Pixel* const line = &_tile.at(0, row);
+
+        while(mask != 0){
+            const uint32_t start = __builtin_clz(mask);
+            const uint32_t inverted = ~(mask << start);
+            const uint32_t runEnd = start + ((inverted == 0) ? (32 - start) : __builtin_clz(inverted));
+
+            std::fill_n(&line[left + static_cast<int32_t>(start)], runEnd - start, color);
+
+            mask = (runEnd >= 32) ? 0 : (mask & (0xFFFFFFFF >> runEnd));
+        }
+    }
+
+    Rect TileRenderer::render(const DisplayList& list, FrameBuffer& target){
+        uint32_t left = UINT32_MAX;
+        uint32_t top = UINT32_MAX;
+        uint32_t right = 0;
+        uint32_t bottom = 0;
+
+        if(_tileWidth == 0 || _tileHeight == 0){
+            return Rect{0, 0, 0, 0};
+        }
+
+        for(uint32_t tileY = 0; tileY < target.getHeight(); tileY += _tileHeight){
+            for(uint32_t tileX = 0; tileX < target.getWidth(); tileX += _tileWidth){
+                const Rect area{
+                    tileX, tileY,
+                    std::min(_tileWidth, target.getWidth() - tileX),
+                    std::min(_tileHeight, target.getHeight() - tileY)
+                };
+
+                // Bin: commands that touch this tile, and the last fill covering all of it.
+                uint64_t bin = 0;
+                uint32_t first = 0;
+                bool isCovered = false;
+
+                for(uint32_t idx = 0; idx < list.getCount(); idx++){
+                    const DisplayList::Command& command = list.getCommand(idx);
+                    const Rect clipped = intersect(boundsOf(command), area);
+
+                    if(clipped.width == 0){
+                        continue;
+                    }
+
+                    bin |= static_cast<uint64_t>(1) << idx;
+                    _statistics.commandPixels += clipped.width * clipped.height;
+
+                    if(command.kind == DisplayList::FILL_RECT && clipped.width == area.width && clipped.height == area.height){
+                        first = idx;
+                        isCovered = true;
+                    }
+                }
+
+                if(bin == 0){
+                    continue;
+                }
+
+                if(isCovered == false){
+                    transfer(target, area, false);
+                    _statistics.loadedTiles++;
+                    _statistics.loadedPixels += area.width * area.height;
+                }
+
+                for(uint32_t idx = first; idx < list.getCount(); idx++){
+                    if((bin >> idx) & 1){
+                        drawCommand(list, list.getCommand(idx), area);
+                    }
+                }
+
+                transfer(target, area, true);
+                _statistics.flushedTiles++;
+                _statistics.flushedPixels += area.width * area.height;
+
+                left = std::min(left, area.x);
+                top = std::min(top, area.y);
+                right = std::max(right, area.x + area.width);
+                bottom = std::max(bottom, area.y + area.height);
+            }
+        }
+
+        if(right == 0){
+            return Rect{0, 0, 0, 0};
+        }
+
+        return Rect{left, top, right - left, bottom - top};
+    }
+
+    void TileRenderer::resetStatistics(){
+        _statistics = Statistics{};
+    }
+}
@@ -0,0 +1,57 @@
+#include "Utf8Reader.hpp"
+
+#include <cstdint>
+
+namespace TFT_LCD {
+    uint32_t Utf8Reader::nextMultiByte(){
+        const uint8_t lead = static_cast<uint8_t>(_text[_position]);
+
+        uint32_t length = 0;
+        uint32_t codepoint = 0;
+        uint32_t minimum = 0;
+
+        if((lead & 0xE0) == 0xC0){
+            length = 2;
+            codepoint = lead & 0x1F;
+            minimum = 0x80;
+        }
+        else if((lead & 0xF0) == 0xE0){
+            length = 3;
+            codepoint = lead & 0x0F;
+            minimum = 0x800;
+        }
+        else if((lead & 0xF8) == 0xF0){
+            length = 4;
+            codepoint = lead & 0x07;
+            minimum = 0x10000;
+        }
+        else{
+            _position++;
+            return REPLACEMENT_CHARACTER;
+        }
+
+        if(_position + length > _text.size()){
+            _position++;
+            return REPLACEMENT_CHARACTER;
+        }
+
+        for(uint32_t idx = 1; idx < length; idx++){
+            const uint8_t continuation = static_cast<uint8_t>(_text[_position + idx]);
+
+            if((continuation & 0xC0) != 0x80){
+                _position++;
+                return REPLACEMENT_CHARACTER;
+            }
+
+            codepoint = (codepoint << 6) | (continuation & 0x3F);
+        }
+
+        if(codepoint < minimum || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF)){
+            _position++;
+            return REPLACEMENT_CHARACTER;
+        }
+
+        _position += length;
+        return codepoint;
+    }
+}
@@ -0,0 +1,94 @@
+#include "VirtualCanvas.hpp"
+#include "Dma2dEngine.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace TFT_LCD {
+    VirtualCanvas::VirtualCanvas(uint16_t* buffer, uint32_t width, uint32_t height, uint32_t viewWidth, uint32_t viewHeight, Layout layout, DMA2D_HandleTypeDef* hdma2d)
+        : _buffer{buffer, width, height}, _viewWidth{viewWidth}, _viewHeight{viewHeight},
+          _layout{(layout == VERTICAL_RING && height >= 2 * viewHeight) ? VERTICAL_RING : PLANAR},
+          _hdma2d{hdma2d},
+          _ringHeight{(_layout == VERTICAL_RING) ? (height - viewHeight) : height}
+    {
+    }
+
+    void VirtualCanvas::copyRows(uint32_t source, uint32_t destination, uint32_t rows, DMA2D_HandleTypeDef* hdma2d){
+        const uint32_t pitch = _buffer.getWidth();
+        const Pixel* const from = &_buffer.at(0, source);
+        Pixel* const to = &_buffer.at(0, destination);
+
+        if(hdma2d != nullptr){
+            Dma2dEngine(hdma2d).copy(from, pitch, to, pitch, pitch, rows);
+            return;
+        }
+
+        // Full-width rows are contiguous: one block copy.
+        memcpy(to, from, rows * pitch * sizeof(Pixel));
+    }
+
+    void VirtualCanvas::panTo(uint32_t left, uint32_t top){
+        _viewLeft = std::min(left, _buffer.getWidth() - _viewWidth);
+
+        if(_layout == PLANAR){
+            _viewTop = std::min(top, _buffer.getHeight() - _viewHeight);
+        }
+    }
+
+    Rect VirtualCanvas::scroll(int32_t lines){
+        if(_layout == PLANAR || lines == 0){
+            return Rect{0, 0, 0, 0};
+        }
+
+        // Rows of a previous step not shown with `showCanvas`: the driver may be
+        // using DMA2D, so duplicate them with the CPU.
+        commitRows(nullptr);
+
+        const uint32_t distance = static_cast<uint32_t>((lines > 0) ? lines : -lines);
+        const uint32_t revealed = std::min(distance, _viewHeight);
+        const uint32_t step = distance % _ringHeight;
+
+        _scrollPosition += lines;
+
+        if(lines > 0){
+            _viewTop = (_viewTop + step) % _ringHeight;
+            _pendingTop = _viewTop + _viewHeight - revealed;
+        }
+        else{
+            _viewTop = (_viewTop + _ringHeight - step) % _ringHeight;
+            _pendingTop = _viewTop;
+        }
+
+        _pendingBottom = _pendingTop + revealed;
+
+        return Rect{0, _pendingTop, _buffer.getWidth(), revealed};
+    }
+
+    void VirtualCanvas::commit(){
+        commitRows(_hdma2d);
+    }
+
+    void VirtualCanvas::commitRows(DMA2D_HandleTypeDef* hdma2d){
+        const uint32_t top = _pendingTop;
+        const uint32_t bottom = _pendingBottom;
+
+        _pendingTop = 0;
+        _pendingBottom = 0;
+
+        if(bottom <= top){
+            return;
+        }
+
+        // Ring rows [0, viewHeight) have a copy at [ringHeight, ringHeight + viewHeight).
+        if(top < _viewHeight){
+            copyRows(top, top + _ringHeight, std::min(bottom, _viewHeight) - top, hdma2d);
+        }
+
+        if(bottom > _ringHeight){
+            const uint32_t start = std::max(top, _ringHeight);
+
+            copyRows(start, start - _ringHeight, bottom - start, hdma2d);
+        }
+    }
+}
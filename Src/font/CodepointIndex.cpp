@@ -0,0 +1,38 @@
+#include "font/CodepointIndex.hpp"
+
+#include <cstdint>
+
+namespace TFT_LCD {
+    int32_t CodepointIndex::find(uint32_t codepoint) const {
+        if(rangeCount == 0){
+            return -1;
+        }
+
+        // Fast path: the first range usually holds printable ASCII.
+        const uint32_t offset = codepoint - ranges[0].first;
+
+        if(codepoint >= ranges[0].first && offset < ranges[0].count){
+            return ranges[0].glyphIndex + offset;
+        }
+
+        uint32_t low = 1;
+        uint32_t high = rangeCount;
+
+        while(low < high){
+            const uint32_t middle = (low + high) / 2;
+            const CodepointRange& range = ranges[middle];
+
+            if(codepoint < range.first){
+                high = middle;
+            }
+            else if(codepoint - range.first >= range.count){
+                low = middle + 1;
+            }
+            else{
+                return range.glyphIndex + (codepoint - range.first);
+            }
+        }
+
+        return -1;
+    }
+}
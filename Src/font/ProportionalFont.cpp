@@ -0,0 +1,30 @@
+#include "font/ProportionalFont.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace TFT_LCD {
+    int32_t ProportionalFont::getGlyphIndex(uint32_t codepoint) const {
+        return index.find(codepoint);
+    }
+
+    int32_t ProportionalFont::getKerning(uint16_t left, uint16_t right) const {
+        if(kerningPairs == nullptr || kerningPairCount == 0){
+            return 0;
+        }
+
+        const KerningPair* const first = kerningPairs;
+        const KerningPair* const last = kerningPairs + kerningPairCount;
+
+        const KerningPair* const pair = std::lower_bound(first, last, KerningPair{left, right, 0},
+            [](const KerningPair& a, const KerningPair& b){
+                return a.left != b.left ? a.left < b.left : a.right < b.right;
+            });
+
+        if(pair == last || pair->left != left || pair->right != right){
+            return 0;
+        }
+
+        return pair->adjust;
+    }
+}
@@ -0,0 +1,376 @@
+/**
+ * @file font20_compact.cpp
+ * @brief Compact font generated by tools/fontc.py from font20.cpp.
+ *
+ * @details
+ * 14x20 cell, 95 glyphs, 1227 data bytes. Do not edit by hand.
+ */
+
+#include "font/CompactFont.hpp"
+
+namespace TFT_LCD {
+    extern const CompactFont Font20Compact;
+
+    namespace {
+        const uint8_t Font20Compact_Data[] = {
+            // @0 '!' 3x13
+            0xFF, 0xFF, 0xFA, 0x40, 0x7E,
+            // @5 '"' 8x6
+            0xE7, 0xE7, 0xE7, 0x42, 0x42, 0x42,
+            // @11 '#' 10x16
+            0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x3F, 0xFF, 0xFC, 0xCC, 0x33, 0x3F,
+            0xFF, 0xFC, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC,
+            // @31 '$' 8x16
+            0x18, 0x18, 0x3F, 0x7F, 0xC3, 0xC0, 0xF8, 0x7E, 0x07, 0xC3, 0xC3, 0xFE,
+            0xFC, 0x18, 0x18, 0x18,
+            // @47 '%' 9x13
+            0x70, 0x44, 0x22, 0x11, 0x07, 0x18, 0x3C, 0xF9, 0xE0, 0xC7, 0x04, 0x42,
+            0x21, 0x10, 0x70,
+            // @62 '&' 9x11
+            0x1F, 0x3F, 0x98, 0x0C, 0x03, 0x03, 0xCF, 0xFF, 0x9E, 0xC6, 0x7F, 0xCF,
+            0x60,
+            // @75 U+0027 3x6
+            0xFF, 0xA4, 0x80,
+            // @78 '(' 4x16
+            0x33, 0x66, 0x6C, 0xCC, 0xCC, 0xC6, 0x66, 0x33,
+            // @86 ')' 4x16
+            0xCC, 0x66, 0x63, 0x33, 0x33, 0x36, 0x66, 0xCC,
+            // @94 '*' 8x9
+            0x18, 0x18, 0x18, 0xDB, 0xFF, 0x3C, 0x3C, 0x7E, 0x66,
+            // @103 '+' 10x10
+            0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03,
+            0x00,
+            // @116 ',' 4x6
+            0x76, 0x6C, 0xC8,
+            // @119 '-' 9x2
+            0xFF, 0xFF, 0xC0,
+            // @122 '.' 3x3
+            0xFF, 0x80,
+            // @124 '/' 8x16
+            0x03, 0x03, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x60,
+            0x60, 0x60, 0xC0, 0xC0,
+            // @140 '0' 9x13
+            0x3E, 0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xD8,
+            0xCF, 0xE3, 0xE0,
+            // @155 '1' 8x13
+            0x18, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+            0xFF,
+            // @168 '2' 9x13
+            0x3E, 0x3F, 0xB8, 0xF8, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+            0x1F, 0xFF, 0xF8,
+            // @183 '3' 10x13
+            0x1F, 0x1F, 0xE6, 0x1C, 0x03, 0x01, 0xC3, 0xE0, 0xF8, 0x07, 0x00, 0xC0,
+            0x3C, 0x1F, 0xFE, 0x7F, 0x00,
+            // @200 '4' 9x13
+            0x07, 0x07, 0x83, 0xC3, 0x63, 0x31, 0x99, 0x8D, 0x86, 0xFF, 0xFF, 0xC0,
+            0xC1, 0xF0, 0xF8,
+            // @215 '5' 9x13
+            0x7F, 0x3F, 0x98, 0x0C, 0x07, 0xE3, 0xF9, 0x8E, 0x03, 0x01, 0x80, 0xF0,
+            0xFF, 0xE7, 0xE0,
+            // @230 '6' 9x13
+            0x0F, 0x9F, 0xDE, 0x0C, 0x0E, 0x06, 0xF3, 0xFD, 0xC7, 0xC1, 0xE0, 0xD8,
+            0xEF, 0xE1, 0xE0,
+            // @245 '7' 9x13
+            0xFF, 0xFF, 0xF0, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x03, 0x03,
+            0x01, 0x80, 0xC0,
+            // @260 '8' 9x13
+            0x3E, 0x3F, 0xB8, 0xF8, 0x3E, 0x3B, 0xF9, 0xFD, 0xC7, 0xC1, 0xE0, 0xF8,
+            0xEF, 0xE3, 0xE0,
+            // @275 '9' 9x13
+            0x3C, 0x3F, 0xB8, 0xD8, 0x3C, 0x1F, 0x1D, 0xFE, 0x7B, 0x03, 0x81, 0x83,
+            0xDF, 0xCF, 0x80,
+            // @290 ':' 3x9
+            0xFF, 0x80, 0x3F, 0xE0,
+            // @294 ';' 5x11
+            0x39, 0xCE, 0x00, 0x01, 0xCC, 0xC6, 0x20,
+            // @301 '<' 11x11
+            0x00, 0x60, 0x3C, 0x1E, 0x07, 0x03, 0x81, 0xE0, 0x0E, 0x00, 0x70, 0x07,
+            0x80, 0x3C, 0x01, 0x80,
+            // @317 '=' 11x6
+            0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
+            // @326 '>' 11x11
+            0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x00, 0x38, 0x03, 0xC0, 0xE0, 0x70, 0x3C,
+            0x1E, 0x03, 0x00, 0x00,
+            // @342 '?' 8x12
+            0x7C, 0xFE, 0xC3, 0xC3, 0x03, 0x0E, 0x1C, 0x18, 0x00, 0x00, 0x38, 0x38,
+            // @354 '@' 7x14
+            0x1C, 0xC9, 0x0C, 0x18, 0x31, 0xE4, 0xC9, 0x93, 0x1E, 0x02, 0x04, 0x27,
+            0x80,
+            // @367 'A' 12x12
+            0x3F, 0x03, 0xF0, 0x07, 0x00, 0xD8, 0x0D, 0x81, 0x98, 0x18, 0xC3, 0xFC,
+            0x3F, 0xC6, 0x06, 0xF0, 0xFF, 0x0F,
+            // @385 'B' 10x12
+            0xFE, 0x3F, 0xC6, 0x19, 0x86, 0x63, 0x9F, 0xC7, 0xF9, 0x87, 0x60, 0xD8,
+            0x3F, 0xFF, 0xFE,
+            // @400 'C' 10x12
+            0x1E, 0xCF, 0xF7, 0x1F, 0x83, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xE0, 0xDC,
+            0x73, 0xF8, 0x7C,
+            // @415 'D' 11x12
+            0xFF, 0x1F, 0xF1, 0x87, 0x30, 0x76, 0x06, 0xC0, 0xD8, 0x1B, 0x03, 0x60,
+            0xEC, 0x3B, 0xFE, 0x7F, 0x80,
+            // @432 'E' 10x12
+            0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1, 0x98, 0x60, 0xD8,
+            0x3F, 0xFF, 0xFF,
+            // @447 'F' 10x12
+            0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1, 0x98, 0x60, 0x18,
+            0x0F, 0xC3, 0xF0,
+            // @462 'G' 11x12
+            0x1E, 0xCF, 0xF9, 0x87, 0x60, 0x6C, 0x01, 0x80, 0x31, 0xFE, 0x3F, 0xC0,
+            0xCC, 0x19, 0xFF, 0x0F, 0x80,
+            // @479 'H' 10x12
+            0xF3, 0xFC, 0xF6, 0x19, 0x86, 0x61, 0x9F, 0xE7, 0xF9, 0x86, 0x61, 0x98,
+            0x6F, 0x3F, 0xCF,
+            // @494 'I' 8x12
+            0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF,
+            // @506 'J' 11x12
+            0x0F, 0xE1, 0xFC, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x30, 0x66, 0x0C, 0xC1,
+            0x98, 0x73, 0xFC, 0x1F, 0x00,
+            // @523 'K' 11x12
+            0xFB, 0xFF, 0x7D, 0x8E, 0x33, 0x06, 0xC0, 0xF8, 0x1D, 0x83, 0x18, 0x63,
+            0x0C, 0x33, 0xE7, 0xFC, 0x70,
+            // @540 'L' 10x12
+            0xFC, 0x3F, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC3, 0x30, 0xCC,
+            0x3F, 0xFF, 0xFF,
+            // @555 'M' 12x12
+            0xF0, 0xFF, 0x0F, 0x70, 0xE7, 0x9E, 0x69, 0x66, 0xF6, 0x6F, 0x66, 0x66,
+            0x66, 0x66, 0x06, 0xF9, 0xFF, 0x9F,
+            // @573 'N' 10x12
+            0xE7, 0xFD, 0xF7, 0x19, 0xE6, 0x79, 0x9B, 0x66, 0xD9, 0x9E, 0x67, 0x98,
+            0xEF, 0xBB, 0xE6,
+            // @588 'O' 10x12
+            0x1E, 0x0F, 0xC7, 0x3B, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDC,
+            0xE3, 0xF0, 0x78,
+            // @603 'P' 10x12
+            0xFF, 0x3F, 0xE6, 0x1D, 0x83, 0x60, 0xD8, 0x77, 0xF9, 0xFC, 0x60, 0x18,
+            0x0F, 0xC3, 0xF0,
+            // @618 'Q' 10x15
+            0x1E, 0x0F, 0xC7, 0x3B, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDC,
+            0xE3, 0xF0, 0x78, 0x1E, 0xCF, 0xF3, 0x38,
+            // @637 'R' 11x12
+            0xFF, 0x1F, 0xF1, 0x87, 0x30, 0x66, 0x1C, 0xFF, 0x1F, 0xC3, 0x1C, 0x61,
+            0x8C, 0x3B, 0xE3, 0xFC, 0x30,
+            // @654 'S' 10x12
+            0x3E, 0xDF, 0xFE, 0x1F, 0x03, 0xE0, 0x1F, 0x81, 0xF8, 0x07, 0xC0, 0xF8,
+            0x7F, 0xFB, 0x7C,
+            // @669 'T' 10x12
+            0xFF, 0xFF, 0xFC, 0xCF, 0x33, 0xCC, 0xC3, 0x00, 0xC0, 0x30, 0x0C, 0x03,
+            0x03, 0xF0, 0xFC,
+            // @684 'U' 10x12
+            0xF3, 0xFC, 0xF6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9C,
+            0xE3, 0xF0, 0x78,
+            // @699 'V' 11x12
+            0xF1, 0xFE, 0x3D, 0x83, 0x30, 0x63, 0x18, 0x63, 0x06, 0xC0, 0xD8, 0x1B,
+            0x01, 0xC0, 0x38, 0x07, 0x00,
+            // @716 'W' 13x12
+            0xF8, 0xFF, 0xC7, 0xD8, 0x0C, 0xCE, 0x66, 0x73, 0x33, 0x99, 0xB6, 0xC5,
+            0xB4, 0x38, 0xE1, 0xC7, 0x0E, 0x38, 0x60, 0xC0,
+            // @736 'X' 11x12
+            0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC1, 0xB0, 0x1C, 0x03, 0x80, 0xD8, 0x31,
+            0x8C, 0x1B, 0xC7, 0xF8, 0xF0,
+            // @753 'Y' 10x12
+            0xF3, 0xFC, 0xF6, 0x18, 0xCC, 0x1E, 0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03,
+            0x03, 0xF0, 0xFC,
+            // @768 'Z' 8x12
+            0xFF, 0xFF, 0xC3, 0xC6, 0x0C, 0x18, 0x18, 0x30, 0x63, 0xC3, 0xFF, 0xFF,
+            // @780 '[' 4x16
+            0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFF,
+            // @788 U+005C 8x16
+            0xC0, 0xC0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06,
+            0x06, 0x06, 0x03, 0x03,
+            // @804 ']' 4x16
+            0xFF, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFF,
+            // @812 '^' 9x6
+            0x08, 0x0E, 0x0D, 0x8C, 0x6C, 0x1C, 0x04,
+            // @819 '_' 14x2
+            0xFF, 0xFF, 0xFF, 0xF0,
+            // @823 '`' 4x3
+            0x86, 0x10,
+            // @825 'a' 10x9
+            0x3F, 0x1F, 0xE0, 0x18, 0xFE, 0x7F, 0xB8, 0x6C, 0x3B, 0xFF, 0x7D, 0xC0,
+            // @837 'b' 11x13
+            0xE0, 0x1C, 0x01, 0x80, 0x30, 0x06, 0xF0, 0xFF, 0x9C, 0x33, 0x03, 0x60,
+            0x6C, 0x0D, 0xC3, 0x7F, 0xEE, 0xF0,
+            // @855 'c' 10x9
+            0x1E, 0xDF, 0xF6, 0x0F, 0x03, 0xC0, 0x30, 0x0E, 0x0D, 0xFF, 0x3F, 0x00,
+            // @867 'd' 11x13
+            0x01, 0xC0, 0x38, 0x03, 0x00, 0x61, 0xEC, 0xFF, 0x98, 0x76, 0x06, 0xC0,
+            0xD8, 0x1B, 0x87, 0x3F, 0xF1, 0xEE,
+            // @885 'e' 10x9
+            0x1E, 0x1F, 0xE6, 0x1B, 0xFF, 0xFF, 0xF0, 0x06, 0x0D, 0xFF, 0x1F, 0x00,
+            // @897 'f' 9x13
+            0x1F, 0x9F, 0xCC, 0x06, 0x0F, 0xF7, 0xF8, 0xC0, 0x60, 0x30, 0x18, 0x0C,
+            0x1F, 0xEF, 0xF0,
+            // @912 'g' 11x13
+            0x1E, 0xEF, 0xFD, 0x87, 0x60, 0x6C, 0x0D, 0x81, 0x98, 0x73, 0xFE, 0x1E,
+            0xC0, 0x18, 0x07, 0x1F, 0xC3, 0xF0,
+            // @930 'h' 10x13
+            0xE0, 0x38, 0x06, 0x01, 0x80, 0x6F, 0x1F, 0xE7, 0x19, 0x86, 0x61, 0x98,
+            0x66, 0x1B, 0xCF, 0xF3, 0xC0,
+            // @947 'i' 8x13
+            0x18, 0x18, 0x00, 0x00, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+            0xFF,
+            // @960 'j' 8x17
+            0x0C, 0x0C, 0x00, 0x00, 0x7F, 0x7F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+            0x03, 0x03, 0x07, 0xFE, 0xFC,
+            // @977 'k' 10x13
+            0xE0, 0x38, 0x06, 0x01, 0x80, 0x6F, 0x9B, 0xE6, 0xC1, 0xE0, 0x78, 0x1B,
+            0x06, 0x63, 0x9F, 0xE7, 0xC0,
+            // @994 'l' 8x13
+            0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+            0xFF,
+            // @1007 'm' 12x9
+            0xFD, 0xCF, 0xFE, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6F, 0x77,
+            0xF7, 0x70,
+            // @1021 'n' 10x9
+            0xEF, 0x3F, 0xE7, 0x19, 0x86, 0x61, 0x98, 0x66, 0x1B, 0xCF, 0xF3, 0xC0,
+            // @1033 'o' 10x9
+            0x1E, 0x1F, 0xE6, 0x1B, 0x03, 0xC0, 0xF0, 0x36, 0x19, 0xFE, 0x1E, 0x00,
+            // @1045 'p' 11x13
+            0xEF, 0x1F, 0xF9, 0xC3, 0x30, 0x36, 0x06, 0xC0, 0xDC, 0x33, 0xFE, 0x6F,
+            0x0C, 0x01, 0x80, 0x7C, 0x0F, 0x80,
+            // @1063 'q' 11x13
+            0x1E, 0xEF, 0xFD, 0x87, 0x60, 0x6C, 0x0D, 0x81, 0x98, 0x73, 0xFE, 0x1E,
+            0xC0, 0x18, 0x03, 0x01, 0xF0, 0x3E,
+            // @1081 'r' 10x9
+            0xF3, 0xBD, 0xF3, 0xCC, 0xE0, 0x30, 0x0C, 0x03, 0x03, 0xFC, 0xFF, 0x00,
+            // @1093 's' 8x9
+            0x3F, 0xFF, 0xC3, 0xF0, 0x7E, 0x0F, 0xC3, 0xFF, 0xFC,
+            // @1102 't' 10x12
+            0x30, 0x0C, 0x03, 0x03, 0xFE, 0xFF, 0x8C, 0x03, 0x00, 0xC0, 0x30, 0x0C,
+            0x33, 0xFC, 0x7C,
+            // @1117 'u' 10x9
+            0xE3, 0xB8, 0xE6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x39, 0xFF, 0x3D, 0xC0,
+            // @1129 'v' 11x9
+            0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC3, 0x18, 0x36, 0x06, 0xC0, 0x70, 0x0E,
+            0x00,
+            // @1142 'w' 11x9
+            0xF1, 0xFE, 0x3D, 0x93, 0x32, 0x66, 0xFC, 0x77, 0x0E, 0xE1, 0x8C, 0x31,
+            0x80,
+            // @1155 'x' 10x9
+            0xF3, 0xFC, 0xF3, 0x30, 0x78, 0x0C, 0x07, 0x83, 0x33, 0xCF, 0xF3, 0xC0,
+            // @1167 'y' 11x13
+            0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC3, 0x18, 0x36, 0x07, 0xC0, 0x70, 0x0C,
+            0x01, 0x80, 0x60, 0x7F, 0x0F, 0xE0,
+            // @1185 'z' 8x9
+            0xFF, 0xFF, 0xC6, 0x0C, 0x18, 0x30, 0x63, 0xFF, 0xFF,
+            // @1194 '{' 6x16
+            0x1C, 0xF3, 0x0C, 0x30, 0xC3, 0x1C, 0xE1, 0xC3, 0x0C, 0x30, 0xC3, 0xC7,
+            // @1206 '|' 2x16
+            0xFF, 0xFF, 0xFF, 0xFF,
+            // @1210 '}' 6x16
+            0xE3, 0xC3, 0x0C, 0x30, 0xC3, 0x0E, 0x1C, 0xE3, 0x0C, 0x30, 0xCF, 0x38,
+            // @1222 '~' 10x4
+            0x38, 0x3F, 0x3C, 0xFC, 0x1E,
+        };
+
+        const CompactGlyph Font20Compact_Glyphs[] = {
+            {     0,  0,  0,  0,  0 }, // U+0020
+            {     0,  5,  1,  3, 13 }, // '!'
+            {     5,  3,  2,  8,  6 }, // '"'
+            {    11,  2,  0, 10, 16 }, // '#'
+            {    31,  3,  0,  8, 16 }, // '$'
+            {    47,  2,  1,  9, 13 }, // '%'
+            {    62,  3,  3,  9, 11 }, // '&'
+            {    75,  6,  2,  3,  6 }, // U+0027
+            {    78,  6,  1,  4, 16 }, // '('
+            {    86,  4,  1,  4, 16 }, // ')'
+            {    94,  3,  1,  8,  9 }, // '*'
+            {   103,  2,  3, 10, 10 }, // '+'
+            {   116,  5, 11,  4,  6 }, // ','
+            {   119,  2,  7,  9,  2 }, // '-'
+            {   122,  6, 11,  3,  3 }, // '.'
+            {   124,  3,  0,  8, 16 }, // '/'
+            {   140,  2,  1,  9, 13 }, // '0'
+            {   155,  3,  1,  8, 13 }, // '1'
+            {   168,  2,  1,  9, 13 }, // '2'
+            {   183,  1,  1, 10, 13 }, // '3'
+            {   200,  2,  1,  9, 13 }, // '4'
+            {   215,  2,  1,  9, 13 }, // '5'
+            {   230,  2,  1,  9, 13 }, // '6'
+            {   245,  2,  1,  9, 13 }, // '7'
+            {   260,  2,  1,  9, 13 }, // '8'
+            {   275,  2,  1,  9, 13 }, // '9'
+            {   290,  6,  5,  3,  9 }, // ':'
+            {   294,  5,  5,  5, 11 }, // ';'
+            {   301,  1,  3, 11, 11 }, // '<'
+            {   317,  1,  5, 11,  6 }, // '='
+            {   326,  2,  3, 11, 11 }, // '>'
+            {   342,  3,  2,  8, 12 }, // '?'
+            {   354,  3,  1,  7, 14 }, // '@'
+            {   367,  1,  2, 12, 12 }, // 'A'
+            {   385,  2,  2, 10, 12 }, // 'B'
+            {   400,  2,  2, 10, 12 }, // 'C'
+            {   415,  1,  2, 11, 12 }, // 'D'
+            {   432,  2,  2, 10, 12 }, // 'E'
+            {   447,  2,  2, 10, 12 }, // 'F'
+            {   462,  2,  2, 11, 12 }, // 'G'
+            {   479,  2,  2, 10, 12 }, // 'H'
+            {   494,  3,  2,  8, 12 }, // 'I'
+            {   506,  2,  2, 11, 12 }, // 'J'
+            {   523,  2,  2, 11, 12 }, // 'K'
+            {   540,  2,  2, 10, 12 }, // 'L'
+            {   555,  1,  2, 12, 12 }, // 'M'
+            {   573,  2,  2, 10, 12 }, // 'N'
+            {   588,  2,  2, 10, 12 }, // 'O'
+            {   603,  2,  2, 10, 12 }, // 'P'
+            {   618,  2,  2, 10, 15 }, // 'Q'
+            {   637,  2,  2, 11, 12 }, // 'R'
+            {   654,  2,  2, 10, 12 }, // 'S'
+            {   669,  2,  2, 10, 12 }, // 'T'
+            {   684,  2,  2, 10, 12 }, // 'U'
+            {   699,  1,  2, 11, 12 }, // 'V'
+            {   716,  1,  2, 13, 12 }, // 'W'
+            {   736,  1,  2, 11, 12 }, // 'X'
+            {   753,  2,  2, 10, 12 }, // 'Y'
+            {   768,  3,  2,  8, 12 }, // 'Z'
+            {   780,  6,  1,  4, 16 }, // '['
+            {   788,  3,  0,  8, 16 }, // U+005C
+            {   804,  4,  1,  4, 16 }, // ']'
+            {   812,  2,  1,  9,  6 }, // '^'
+            {   819,  0, 18, 14,  2 }, // '_'
+            {   823,  5,  1,  4,  3 }, // '`'
+            {   825,  2,  5, 10,  9 }, // 'a'
+            {   837,  1,  1, 11, 13 }, // 'b'
+            {   855,  2,  5, 10,  9 }, // 'c'
+            {   867,  2,  1, 11, 13 }, // 'd'
+            {   885,  2,  5, 10,  9 }, // 'e'
+            {   897,  3,  1,  9, 13 }, // 'f'
+            {   912,  2,  5, 11, 13 }, // 'g'
+            {   930,  2,  1, 10, 13 }, // 'h'
+            {   947,  3,  1,  8, 13 }, // 'i'
+            {   960,  2,  1,  8, 17 }, // 'j'
+            {   977,  2,  1, 10, 13 }, // 'k'
+            {   994,  3,  1,  8, 13 }, // 'l'
+            {  1007,  1,  5, 12,  9 }, // 'm'
+            {  1021,  2,  5, 10,  9 }, // 'n'
+            {  1033,  2,  5, 10,  9 }, // 'o'
+            {  1045,  1,  5, 11, 13 }, // 'p'
+            {  1063,  2,  5, 11, 13 }, // 'q'
+            {  1081,  2,  5, 10,  9 }, // 'r'
+            {  1093,  3,  5,  8,  9 }, // 's'
+            {  1102,  2,  2, 10, 12 }, // 't'
+            {  1117,  2,  5, 10,  9 }, // 'u'
+            {  1129,  1,  5, 11,  9 }, // 'v'
+            {  1142,  1,  5, 11,  9 }, // 'w'
+            {  1155,  2,  5, 10,  9 }, // 'x'
+            {  1167,  1,  5, 11, 13 }, // 'y'
+            {  1185,  3,  5,  8,  9 }, // 'z'
+            {  1194,  4,  1,  6, 16 }, // '{'
+            {  1206,  6,  1,  2, 16 }, // '|'
+            {  1210,  3,  1,  6, 16 }, // '}'
+            {  1222,  2,  6, 10,  4 }, // '~'
+        };
+
+        const CodepointRange Font20Compact_Ranges[] = {
+            { 0x0020,  95,   0 },
+        };
+    }
+
+    const CompactFont Font20Compact = {
+        Font20Compact_Data,
+        Font20Compact_Glyphs,
+        { Font20Compact_Ranges, 1 },
+        14, /* Width */
+        20, /* Height */
+    };
+}
@@ -0,0 +1,65 @@
+# Build-time font generation for the ILI9341 driver.
+#
+# ili9341_add_font(<target>
+#     NAME <symbol>                 C++ symbol of the generated font
+#     SOURCE <font>                 BDF, PCF or sFONT (.c/.cpp) input
+#     [FORMAT sfont|compact|proportional]   default: compact
+#     [CHARS <text>]                UTF-8 characters to keep
+#     [CHARS_FILE <file>]           UTF-8 file whose characters are kept
+# )
+#
+# Generates <symbol>.cpp and <symbol>.hpp with tools/fontc.py, adds the source
+# to <target> and the generated directory to its include path. Without CHARS
+# or CHARS_FILE every glyph of the input is kept. <target> must link `ili9341`.
+
+set(ILI9341_FONTC ${CMAKE_CURRENT_LIST_DIR}/../tools/fontc.py CACHE INTERNAL "ILI9341 font compiler")
+
+function(ili9341_add_font target)
+    cmake_parse_arguments(FONT "" "NAME;SOURCE;FORMAT;CHARS;CHARS_FILE" "" ${ARGN})
+
+    if(NOT FONT_NAME OR NOT FONT_SOURCE)
+        message(FATAL_ERROR "ili9341_add_font: NAME and SOURCE are required")
+    endif()
+
+    if(NOT FONT_FORMAT)
+        set(FONT_FORMAT compact)
+    endif()
+
+    find_package(Python3 REQUIRED COMPONENTS Interpreter)
+
+    get_filename_component(font_source ${FONT_SOURCE} ABSOLUTE)
+    set(output_dir ${CMAKE_CURRENT_BINARY_DIR}/ili9341_fonts)
+    set(output_source ${output_dir}/${FONT_NAME}.cpp)
+    set(output_header ${output_dir}/${FONT_NAME}.hpp)
+
+    set(subset_args)
+    set(subset_depends)
+
+    if(DEFINED FONT_CHARS)
+        list(APPEND subset_args --chars ${FONT_CHARS})
+    endif()
+
+    if(FONT_CHARS_FILE)
+        get_filename_component(chars_file ${FONT_CHARS_FILE} ABSOLUTE)
+        list(APPEND subset_args --chars-file ${chars_file})
+        list(APPEND subset_depends ${chars_file})
+    endif()
+
+    file(MAKE_DIRECTORY ${output_dir})
+
+    add_custom_command(
+        OUTPUT ${output_source} ${output_header}
+        COMMAND Python3::Interpreter ${ILI9341_FONTC} ${font_source}
+            --format ${FONT_FORMAT}
+            --name ${FONT_NAME}
+            --output ${output_source}
+            --header ${output_header}
+            ${subset_args}
+        DEPENDS ${ILI9341_FONTC} ${font_source} ${subset_depends}
+        COMMENT "Generating ${FONT_FORMAT} font ${FONT_NAME}"
+        VERBATIM
+    )
+
+    target_sources(${target} PRIVATE ${output_source})
+    target_include_directories(${target} PUBLIC ${output_dir})
+endfunction()
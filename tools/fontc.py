@@ -0,0 +1,539 @@
+#!/usr/bin/env python3
+"""Font compiler for the ILI9341 driver.
+
+Converts BDF or PCF bitmap fonts, or existing sFONT C tables, into C++ font
+tables for the driver, optionally keeping only the characters a product uses.
+
+Output formats:
+    sfont         ST sFONT layout (printable ASCII, fixed cell, padded rows)
+    compact       CompactFont: bit-packed glyph bounding boxes, fixed cell
+    proportional  ProportionalFont: per-glyph width, advance and bearing
+
+Examples:
+    tools/fontc.py Src/font/font24.cpp --format compact \\
+        --name Font24Compact --output Src/font/font24_compact.cpp
+    tools/fontc.py ter-u16n.bdf --format proportional --chars "0123456789.-°C" \\
+        --name Readout16 --output readout16.cpp --header readout16.hpp
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+
+class Glyph:
+    """One glyph bitmap placed relative to the pen position and cell top."""
+
+    def __init__(self, codepoint, advance, bearing, top, rows):
+        self.codepoint = codepoint
+        self.advance = advance    # pen advance in pixels
+        self.bearing = bearing    # x of bitmap column 0 relative to the pen
+        self.top = top            # y of bitmap row 0 relative to the cell top
+        self.rows = rows          # list of lists of 0/1, all the same width
+
+    @property
+    def width(self):
+        return len(self.rows[0]) if self.rows else 0
+
+    def bounding_box(self):
+        """Return (x, y, width, height) of the set pixels in bitmap coordinates."""
+        ys = [y for y, row in enumerate(self.rows) if any(row)]
+        if not ys:
+            return 0, 0, 0, 0
+        xs = [x for row in self.rows for x, bit in enumerate(row) if bit]
+        return min(xs), ys[0], max(xs) - min(xs) + 1, ys[-1] - ys[0] + 1
+
+    def cell_rows(self, cell_width, cell_height):
+        """Render the glyph into a cell, cropping whatever falls outside."""
+        cell = [[0] * cell_width for _ in range(cell_height)]
+        for y, row in enumerate(self.rows):
+            for x, bit in enumerate(row):
+                cx, cy = self.bearing + x, self.top + y
+                if bit and 0 <= cx < cell_width and 0 <= cy < cell_height:
+                    cell[cy][cx] = 1
+        return cell
+
+
+class Font:
+    """Glyph set with a common cell height and baseline."""
+
+    def __init__(self, cell_width, cell_height, glyphs, source):
+        self.cell_width = cell_width
+        self.cell_height = cell_height
+        self.glyphs = sorted(glyphs, key=lambda g: g.codepoint)
+        self.source = source
+
+    def subset(self, codepoints):
+        missing = sorted(codepoints - {g.codepoint for g in self.glyphs})
+        if missing:
+            print("warning: no glyph for " + ", ".join(describe(c) for c in missing), file=sys.stderr)
+        self.glyphs = [g for g in self.glyphs if g.codepoint in codepoints]
+
+    def fit_ink(self):
+        """Grow the cell so ink above the ascent or below the descent is kept."""
+        top, bottom = 0, self.cell_height
+        for glyph in self.glyphs:
+            _, y, _, height = glyph.bounding_box()
+            if height:
+                top = min(top, glyph.top + y)
+                bottom = max(bottom, glyph.top + y + height)
+        if top == 0 and bottom == self.cell_height:
+            return
+        print(f"warning: ink reaches {-top} rows above the ascent and {bottom - self.cell_height} rows "
+              f"below the descent; cell grown from {self.cell_height} to {bottom - top} rows", file=sys.stderr)
+        for glyph in self.glyphs:
+            glyph.top -= top
+        self.cell_height = bottom - top
+
+
+# --- Readers ---------------------------------------------------------------
+
+def read_sfont(path):
+    """Parse an ST sFONT table (printable ASCII, row-major, MSB first)."""
+    text = open(path, encoding="utf-8").read()
+    table = re.search(r"_Table\s*\[\]\s*=\s*\{(.*?)\};", text, re.S)
+    width = re.search(r"(\d+),\s*/\*\s*Width", text)
+    height = re.search(r"(\d+),\s*/\*\s*Height", text)
+    if not (table and width and height):
+        sys.exit(f"{path}: not an sFONT table")
+
+    values = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}", re.sub(r"//.*", "", table.group(1)))]
+    cell_width, cell_height = int(width.group(1)), int(height.group(1))
+    width_bytes = (cell_width - 1) // 8 + 1
+
+    glyphs = []
+    for index in range(len(values) // (width_bytes * cell_height)):
+        rows = []
+        for y in range(cell_height):
+            start = (index * cell_height + y) * width_bytes
+            mask = int.from_bytes(bytes(values[start:start + width_bytes]), "big")
+            rows.append([(mask >> (width_bytes * 8 - 1 - x)) & 1 for x in range(cell_width)])
+        glyphs.append(Glyph(0x20 + index, cell_width, 0, 0, rows))
+
+    return Font(cell_width, cell_height, glyphs, os.path.basename(path))
+
+
+def read_bdf(path):
+    """Parse a BDF 2.1 font."""
+    ascent = descent = None
+    bounding_box = None
+    glyphs = []
+    glyph = None
+    bitmap = None
+
+    for line in open(path, encoding="latin-1"):
+        words = line.split()
+        if not words:
+            continue
+        key = words[0]
+
+        if bitmap is not None:
+            if key == "ENDCHAR":
+                glyph["bitmap"] = bitmap
+                glyphs.append(glyph)
+                glyph = bitmap = None
+            else:
+                bitmap.append(words[0])
+        elif key == "FONTBOUNDINGBOX":
+            bounding_box = [int(v) for v in words[1:5]]
+        elif key == "FONT_ASCENT":
+            ascent = int(words[1])
+        elif key == "FONT_DESCENT":
+            descent = int(words[1])
+        elif key == "STARTCHAR":
+            glyph = {"encoding": -1, "dwidth": None, "bbx": None}
+        elif key == "ENCODING" and glyph is not None:
+            glyph["encoding"] = int(words[-1]) if int(words[1]) < 0 and len(words) > 2 else int(words[1])
+        elif key == "DWIDTH" and glyph is not None:
+            glyph["dwidth"] = int(words[1])
+        elif key == "BBX" and glyph is not None:
+            glyph["bbx"] = [int(v) for v in words[1:5]]
+        elif key == "BITMAP" and glyph is not None:
+            bitmap = []
+
+    if bounding_box is None:
+        sys.exit(f"{path}: missing FONTBOUNDINGBOX")
+    if ascent is None:
+        ascent = bounding_box[1] + bounding_box[3]
+    if descent is None:
+        descent = -bounding_box[3]
+
+    result = []
+    for glyph in glyphs:
+        if glyph["encoding"] < 0:
+            continue
+        width, height, x_offset, y_offset = glyph["bbx"] or bounding_box
+        rows = []
+        for hex_row in glyph["bitmap"][:height]:
+            mask = int(hex_row, 16)
+            bits = len(hex_row) * 4
+            rows.append([(mask >> (bits - 1 - x)) & 1 for x in range(width)])
+        advance = glyph["dwidth"] if glyph["dwidth"] is not None else width
+        result.append(Glyph(glyph["encoding"], advance, x_offset, ascent - (y_offset + height), rows))
+
+    cell_width = max((g.advance for g in result), default=bounding_box[0])
+    return Font(cell_width, ascent + descent, result, os.path.basename(path))
+
+
+PCF_PROPERTIES = 1 << 0
+PCF_ACCELERATORS = 1 << 1
+PCF_METRICS = 1 << 2
+PCF_BITMAPS = 1 << 3
+PCF_BDF_ENCODINGS = 1 << 5
+PCF_BDF_ACCELERATORS = 1 << 8
+
+PCF_BYTE_MASK = 1 << 2
+PCF_BIT_MASK = 1 << 3
+PCF_COMPRESSED_METRICS = 0x100
+
+
+class PcfTable:
+    """Cursor over one PCF table honouring its byte order."""
+
+    def __init__(self, data, offset):
+        self.data = data
+        self.position = offset
+        self.format = struct.unpack_from("<I", data, offset)[0]
+        self.position += 4
+        self.order = ">" if self.format & PCF_BYTE_MASK else "<"
+
+    def read(self, code):
+        values = struct.unpack_from(self.order + code, self.data, self.position)
+        self.position += struct.calcsize(self.order + code)
+        return values if len(values) > 1 else values[0]
+
+
+def read_pcf(path):
+    """Parse an X11 PCF font."""
+    data = open(path, "rb").read()
+    if data[:4] != b"\x01fcp":
+        sys.exit(f"{path}: not a PCF font")
+
+    count = struct.unpack_from("<I", data, 4)[0]
+    tables = {}
+    for index in range(count):
+        kind, _, _, offset = struct.unpack_from("<IIII", data, 8 + index * 16)
+        tables[kind] = offset
+
+    for required in (PCF_METRICS, PCF_BITMAPS, PCF_BDF_ENCODINGS):
+        if required not in tables:
+            sys.exit(f"{path}: missing PCF table {required:#x}")
+
+    accelerators = tables.get(PCF_BDF_ACCELERATORS, tables.get(PCF_ACCELERATORS))
+    if accelerators is None:
+        sys.exit(f"{path}: missing PCF accelerators")
+    table = PcfTable(data, accelerators)
+    table.read("8B")
+    ascent, descent = table.read("ii")
+
+    table = PcfTable(data, tables[PCF_METRICS])
+    metrics = []
+    if table.format & PCF_COMPRESSED_METRICS:
+        for _ in range(table.read("h")):
+            metrics.append([v - 0x80 for v in table.read("5B")])
+    else:
+        for _ in range(table.read("i")):
+            metrics.append(list(table.read("5hH")[:5]))
+
+    table = PcfTable(data, tables[PCF_BITMAPS])
+    glyph_count = table.read("i")
+    offsets = [table.read("i") for _ in range(glyph_count)]
+    table.read("4i")
+    bitmap_base = table.position
+    pad = 1 << (table.format & 3)
+    scan_unit = 1 << ((table.format >> 4) & 3)
+    msb_bits = bool(table.format & PCF_BIT_MASK)
+    msb_bytes = bool(table.format & PCF_BYTE_MASK)
+
+    def glyph_rows(index):
+        left, right, _, glyph_ascent, glyph_descent = metrics[index]
+        width = right - left
+        row_bytes = ((width + 7) // 8 + pad - 1) // pad * pad
+        start = bitmap_base + offsets[index]
+        rows = []
+        for y in range(glyph_ascent + glyph_descent):
+            raw = bytearray(data[start + y * row_bytes:start + (y + 1) * row_bytes])
+            if msb_bits != msb_bytes and scan_unit > 1:
+                for unit in range(0, len(raw), scan_unit):
+                    raw[unit:unit + scan_unit] = raw[unit:unit + scan_unit][::-1]
+            if not msb_bits:
+                raw = bytearray(int(f"{b:08b}"[::-1], 2) for b in raw)
+            mask = int.from_bytes(raw, "big")
+            rows.append([(mask >> (len(raw) * 8 - 1 - x)) & 1 for x in range(width)])
+        return rows
+
+    table = PcfTable(data, tables[PCF_BDF_ENCODINGS])
+    min_byte2, max_byte2, min_byte1, max_byte1, _ = table.read("5h")
+    glyphs = []
+    for byte1 in range(min_byte1, max_byte1 + 1):
+        for byte2 in range(min_byte2, max_byte2 + 1):
+            index = table.read("H")
+            if index == 0xFFFF:
+                continue
+            left, _, advance, glyph_ascent, _ = metrics[index]
+            glyphs.append(Glyph((byte1 << 8) | byte2, advance, left, ascent - glyph_ascent, glyph_rows(index)))
+
+    cell_width = max((g.advance for g in glyphs), default=0)
+    return Font(cell_width, ascent + descent, glyphs, os.path.basename(path))
+
+
+# --- Writers ---------------------------------------------------------------
+
+def codepoint_ranges(glyphs):
+    """Group consecutive code points into (first, count, glyph_index) runs."""
+    ranges = []
+    for index, glyph in enumerate(glyphs):
+        if ranges and ranges[-1][0] + ranges[-1][1] == glyph.codepoint and ranges[-1][1] < 0xFFFF:
+            ranges[-1][1] += 1
+        else:
+            ranges.append([glyph.codepoint, 1, index])
+    if not ranges:
+        return ranges
+    # The renderer checks range 0 in constant time; put the largest run there.
+    largest = max(range(len(ranges)), key=lambda i: ranges[i][1])
+    return [ranges[largest]] + ranges[:largest] + ranges[largest + 1:]
+
+
+def describe(codepoint):
+    if 0x20 < codepoint < 0x7F and chr(codepoint) not in "\\'":
+        return f"'{chr(codepoint)}'"
+    return f"U+{codepoint:04X}"
+
+
+def pack_bits(bits):
+    return [int("".join(map(str, bits[i:i + 8])).ljust(8, "0"), 2) for i in range(0, len(bits), 8)]
+
+
+def hex_lines(data, indent):
+    return [indent + ", ".join(f"0x{b:02X}" for b in data[i:i + 12]) + ","
+            for i in range(0, len(data), 12)]
+
+
+def range_lines(ranges):
+    return [f"            {{ 0x{first:04X}, {count:3}, {index:3} }}," for first, count, index in ranges]
+
+
+def file_header(file_name, font, kind, detail):
+    return [
+        "/**",
+        f" * @file {file_name}",
+        f" * @brief {kind} generated by tools/fontc.py from {font.source}.",
+        " *",
+        " * @details",
+        f" * {detail}. Do not edit by hand.",
+        " */",
+        "",
+    ]
+
+
+def emit_sfont(font, name, file_name):
+    """Emit an ST sFONT table covering 0x20..0x7E; absent glyphs stay blank."""
+    if font.cell_width > 32:
+        sys.exit(f"cell is {font.cell_width} px wide, sFONT glyphs are limited to 32")
+    width_bytes = (font.cell_width - 1) // 8 + 1
+    by_codepoint = {g.codepoint: g for g in font.glyphs}
+    lines = []
+    for codepoint in range(0x20, 0x7F):
+        offset = (codepoint - 0x20) * width_bytes * font.cell_height
+        lines.append(f"\t// @{offset} {describe(codepoint)} ({font.cell_width} pixels wide)")
+        glyph = by_codepoint.get(codepoint)
+        cell = glyph.cell_rows(font.cell_width, font.cell_height) if glyph else \
+            [[0] * font.cell_width for _ in range(font.cell_height)]
+        for row in cell:
+            packed = pack_bits(row + [0] * (width_bytes * 8 - font.cell_width))
+            art = "".join("#" if bit else " " for bit in row)
+            lines.append("\t" + ", ".join(f"0x{b:02X}" for b in packed) + f", // {art}")
+        lines.append("")
+
+    source = "\n".join([
+        *file_header(file_name, font, "sFONT", f"{font.cell_width}x{font.cell_height} cell, "
+                     f"{len(by_codepoint.keys() & set(range(0x20, 0x7F)))} of 95 glyphs present"),
+        '#include "font/fonts.hpp"',
+        "",
+        f'extern "C" const sFONT {name};',
+        "",
+        f"const uint8_t {name}_Table [] = ",
+        "{",
+        *lines,
+        "};",
+        "",
+        f"const sFONT {name} = {{",
+        f"  {name}_Table,",
+        f"  {font.cell_width}, /* Width */",
+        f"  {font.cell_height}, /* Height */",
+        "};",
+        "",
+    ])
+    declaration = ['#include "font/fonts.hpp"', "", f'extern "C" const sFONT {name};']
+    return source, declaration, 95 * width_bytes * font.cell_height
+
+
+def emit_compact(font, name, file_name):
+    """Emit a CompactFont definition."""
+    data = []
+    data_lines = []
+    glyph_lines = []
+    for glyph in font.glyphs:
+        cell = Glyph(glyph.codepoint, font.cell_width, 0, 0, glyph.cell_rows(font.cell_width, font.cell_height))
+        x, y, width, height = cell.bounding_box()
+        if width > 24:
+            sys.exit(f"{describe(glyph.codepoint)}: box is {width} px wide, compact glyphs are limited to 24")
+        if len(data) > 0xFFFF:
+            sys.exit("compact data exceeds the 64 KiB offset range")
+
+        packed = pack_bits([bit for row in cell.rows[y:y + height] for bit in row[x:x + width]])
+        glyph_lines.append(f"            {{ {len(data):5}, {x:2}, {y:2}, {width:2}, {height:2} }}, // {describe(glyph.codepoint)}")
+        if packed:
+            data_lines.append(f"            // @{len(data)} {describe(glyph.codepoint)} {width}x{height}")
+            data_lines += hex_lines(packed, "            ")
+        data += packed
+
+    ranges = codepoint_ranges(font.glyphs)
+    source = "\n".join([
+        *file_header(file_name, font, "Compact font", f"{font.cell_width}x{font.cell_height} cell, "
+                     f"{len(font.glyphs)} glyphs, {len(data)} data bytes"),
+        '#include "font/CompactFont.hpp"',
+        "",
+        "namespace TFT_LCD {",
+        f"    extern const CompactFont {name};",
+        "",
+        "    namespace {",
+        f"        const uint8_t {name}_Data[] = {{",
+        *data_lines,
+        "        };",
+        "",
+        f"        const CompactGlyph {name}_Glyphs[] = {{",
+        *glyph_lines,
+        "        };",
+        "",
+        f"        const CodepointRange {name}_Ranges[] = {{",
+        *range_lines(ranges),
+        "        };",
+        "    }",
+        "",
+        f"    const CompactFont {name} = {{",
+        f"        {name}_Data,",
+        f"        {name}_Glyphs,",
+        f"        {{ {name}_Ranges, {len(ranges)} }},",
+        f"        {font.cell_width}, /* Width */",
+        f"        {font.cell_height}, /* Height */",
+        "    };",
+        "}",
+        "",
+    ])
+    declaration = ['#include "font/CompactFont.hpp"', "", "namespace TFT_LCD {",
+                   f"    extern const CompactFont {name};", "}"]
+    return source, declaration, len(data) + len(font.glyphs) * 6 + len(ranges) * 8
+
+
+def emit_proportional(font, name, file_name):
+    """Emit a ProportionalFont definition with cropped glyph columns."""
+    data = []
+    data_lines = []
+    glyph_lines = []
+    for glyph in font.glyphs:
+        # Keep full cell height so rows line up; crop blank columns only.
+        cell_rows = [[0] * glyph.width for _ in range(font.cell_height)]
+        for y, row in enumerate(glyph.rows):
+            if 0 <= glyph.top + y < font.cell_height:
+                cell_rows[glyph.top + y] = row
+        x, _, width, _ = Glyph(0, 0, 0, 0, cell_rows).bounding_box()
+        if width > 32:
+            sys.exit(f"{describe(glyph.codepoint)}: bitmap is {width} px wide, proportional glyphs are limited to 32")
+
+        packed = []
+        for row in cell_rows if width else []:
+            bits = row[x:x + width]
+            packed += pack_bits(bits + [0] * (-len(bits) % 8))
+        glyph_lines.append(f"            {{ {len(data):5}, {width:2}, {glyph.advance:2}, {glyph.bearing + x:3} }}, // {describe(glyph.codepoint)}")
+        if packed:
+            data_lines.append(f"            // @{len(data)} {describe(glyph.codepoint)} {width}x{font.cell_height}")
+            data_lines += hex_lines(packed, "            ")
+        data += packed
+
+    ranges = codepoint_ranges(font.glyphs)
+    source = "\n".join([
+        *file_header(file_name, font, "Proportional font", f"{font.cell_height} px high, "
+                     f"{len(font.glyphs)} glyphs, {len(data)} data bytes"),
+        '#include "font/ProportionalFont.hpp"',
+        "",
+        "namespace TFT_LCD {",
+        f"    extern const ProportionalFont {name};",
+        "",
+        "    namespace {",
+        f"        const uint8_t {name}_Table[] = {{",
+        *data_lines,
+        "        };",
+        "",
+        f"        const GlyphMetrics {name}_Glyphs[] = {{",
+        *glyph_lines,
+        "        };",
+        "",
+        f"        const CodepointRange {name}_Ranges[] = {{",
+        *range_lines(ranges),
+        "        };",
+        "    }",
+        "",
+        f"    const ProportionalFont {name} = {{",
+        f"        {name}_Table,",
+        f"        {name}_Glyphs,",
+        f"        {{ {name}_Ranges, {len(ranges)} }},",
+        "        nullptr,",
+        "        0,",
+        f"        {font.cell_height}, /* Height */",
+        "    };",
+        "}",
+        "",
+    ])
+    declaration = ['#include "font/ProportionalFont.hpp"', "", "namespace TFT_LCD {",
+                   f"    extern const ProportionalFont {name};", "}"]
+    return source, declaration, len(data) + len(font.glyphs) * 8 + len(ranges) * 8
+
+
+WRITERS = {"sfont": emit_sfont, "compact": emit_compact, "proportional": emit_proportional}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="BDF, PCF or sFONT (.c/.cpp) font")
+    parser.add_argument("--format", choices=sorted(WRITERS), default="compact")
+    parser.add_argument("--name", required=True, help="C++ symbol of the generated font")
+    parser.add_argument("--output", required=True, help="generated .cpp file")
+    parser.add_argument("--header", help="also write a header declaring the font")
+    parser.add_argument("--chars", help="UTF-8 characters to keep")
+    parser.add_argument("--chars-file", help="UTF-8 text file whose characters are kept")
+    args = parser.parse_args()
+
+    extension = os.path.splitext(args.input)[1].lower()
+    if extension == ".bdf":
+        font = read_bdf(args.input)
+    elif extension == ".pcf":
+        font = read_pcf(args.input)
+    else:
+        font = read_sfont(args.input)
+
+    if args.chars is not None or args.chars_file is not None:
+        wanted = set(args.chars or "")
+        if args.chars_file:
+            wanted |= set(open(args.chars_file, encoding="utf-8").read())
+        font.subset({ord(c) for c in wanted if c not in "\r\n"})
+    font.fit_ink()
+
+    source, declaration, size = WRITERS[args.format](font, args.name, os.path.basename(args.output))
+
+    with open(args.output, "w", encoding="utf-8") as output:
+        output.write(source)
+
+    if args.header:
+        guard = "__" + re.sub(r"\W", "_", os.path.basename(args.header)).upper() + "__"
+        with open(args.header, "w", encoding="utf-8") as header:
+            header.write("\n".join([f"#ifndef {guard}", f"#define {guard}", "", *declaration, "",
+                                    f"#endif // {guard}", ""]))
+
+    print(f"{args.name}: {len(font.glyphs)} glyphs, {size} bytes")
+
+
+if __name__ == "__main__":
+    main()